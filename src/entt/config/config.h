@@ -7,4 +7,33 @@
 #endif
 
 
+#ifndef ENTT_PAGE_SIZE
+#define ENTT_PAGE_SIZE 32768
+#endif
+
+
+#ifndef ENTT_CHUNK_SIZE
+#define ENTT_CHUNK_SIZE 1024
+#endif
+
+
+#ifndef ENTT_ZIP_SIZE
+#define ENTT_ZIP_SIZE 64
+#endif
+
+
+#ifndef ENTT_PREFETCH_DISTANCE
+#define ENTT_PREFETCH_DISTANCE 16
+#endif
+
+
+#ifndef ENTT_PREFETCH
+#if defined(__GNUC__) || defined(__clang__)
+#define ENTT_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define ENTT_PREFETCH(addr) ((void)(addr))
+#endif
+#endif
+
+
 #endif // ENTT_CONFIG_CONFIG_H
@@ -3,8 +3,13 @@
 
 
 #include <functional>
+#include <type_traits>
 #include <algorithm>
+#include <iterator>
 #include <utility>
+#include <cstddef>
+#include <limits>
+#include <vector>
 
 
 namespace entt {
@@ -70,6 +75,126 @@ struct InsertionSort {
 };
 
 
+/**
+ * @brief Function object for performing LSD radix sort.
+ *
+ * Radix sort doesn't compare elements. Instead, it looks at the digits of an
+ * unsigned integral key that is extracted from each element by means of a
+ * _getter_. The signature of the getter should be equivalent to the following:
+ *
+ * @code{.cpp}
+ * Key(const Type &);
+ * @endcode
+ *
+ * Where `Key` is an unsigned integral type and `Type` is the value type of
+ * the iterators. Elements are sorted in ascending order of their keys and the
+ * sort is stable.<br/>
+ * Keys are visited `Bit` bits at a time and only the `N` least significant bits
+ * are taken in consideration. Passes in which all the keys share the same digit
+ * are skipped.
+ *
+ * @tparam Bit Number of bits processed per pass.
+ * @tparam N Maximum number of bits to sort.
+ */
+template<std::size_t Bit, std::size_t N>
+struct RadixSort {
+    // buckets of all the passes are counted on the stack
+    static_assert(Bit > 0 && Bit <= 12, "!");
+    static_assert((N % Bit) == 0, "!");
+
+    /**
+     * @brief Sorts the elements in a range.
+     *
+     * Sorts the elements in a range using the given getter to extract the
+     * keys. A temporary buffer as large as the range is allocated to store the
+     * intermediate results.
+     *
+     * @tparam It Type of random access iterator.
+     * @tparam Getter Type of function object to use to extract the keys.
+     * @param first An iterator to the first element of the range to sort.
+     * @param last An iterator past the last element of the range to sort.
+     * @param getter A valid function object to use to extract the keys.
+     */
+    template<typename It, typename Getter>
+    void operator()(It first, It last, Getter getter) const {
+        std::vector<typename std::iterator_traits<It>::value_type> aux;
+        (*this)(first, last, std::move(getter), aux);
+    }
+
+    /**
+     * @brief Sorts the elements in a range.
+     *
+     * Sorts the elements in a range using the given getter to extract the
+     * keys. The intermediate results are stored in the buffer provided by the
+     * caller, that is resized as needed. This way, the same buffer can be
+     * reused across sorts and no memory is allocated once it's large enough.
+     *
+     * @tparam It Type of random access iterator.
+     * @tparam Getter Type of function object to use to extract the keys.
+     * @tparam Buffer Type of resizable container of elements.
+     * @param first An iterator to the first element of the range to sort.
+     * @param last An iterator past the last element of the range to sort.
+     * @param getter A valid function object to use to extract the keys.
+     * @param aux A buffer to use to store the intermediate results.
+     */
+    template<typename It, typename Getter, typename Buffer>
+    void operator()(It first, It last, Getter getter, Buffer &aux) const {
+        using key_type = std::decay_t<decltype(getter(*first))>;
+        static_assert(std::is_unsigned<key_type>::value && N <= std::numeric_limits<key_type>::digits, "!");
+
+        constexpr std::size_t buckets = std::size_t{1} << Bit;
+        constexpr std::size_t mask = buckets - 1;
+        constexpr std::size_t passes = N / Bit;
+
+        if(first < last) {
+            const auto length = std::size_t(std::distance(first, last));
+            std::size_t count[passes][buckets]{};
+            bool swapped = false;
+
+            aux.resize(length);
+
+            // histograms of all the passes are built at once, passes then only scatter the elements
+            for(auto it = first; it != last; ++it) {
+                const auto key = getter(*it);
+
+                for(std::size_t pass = 0; pass < passes; ++pass) {
+                    ++count[pass][(key >> (pass * Bit)) & mask];
+                }
+            }
+
+            auto part = [&getter](auto from, auto to, auto out, const std::size_t start, const std::size_t *curr) {
+                std::size_t index[buckets]{};
+
+                for(std::size_t pos = 1; pos < buckets; ++pos) {
+                    index[pos] = index[pos-1] + curr[pos-1];
+                }
+
+                for(auto it = from; it != to; ++it) {
+                    out[index[(getter(*it) >> start) & mask]++] = std::move(*it);
+                }
+            };
+
+            for(std::size_t pass = 0; pass < passes; ++pass) {
+                // all the keys share the same digit, the pass wouldn't change the order
+                if(std::find(std::begin(count[pass]), std::end(count[pass]), length) == std::end(count[pass])) {
+                    if(swapped) {
+                        part(aux.begin(), aux.end(), first, pass * Bit, count[pass]);
+                    } else {
+                        part(first, last, aux.begin(), pass * Bit, count[pass]);
+                    }
+
+                    swapped = !swapped;
+                }
+            }
+
+            if(swapped) {
+                std::move(aux.begin(), aux.end(), first);
+            }
+        }
+    }
+};
+
+
 }
 
 
@@ -0,0 +1,186 @@
+#ifndef ENTT_CORE_EXECUTOR_HPP
+#define ENTT_CORE_EXECUTOR_HPP
+
+
+#include <condition_variable>
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include "../config/config.h"
+
+
+namespace entt {
+
+
+/**
+ * @brief Pool of worker threads to use to run jobs concurrently.
+ *
+ * A thread pool is a valid executor. Executors are function objects that
+ * accept a number of jobs and a callable object. The latter is invoked once for
+ * each index in the range `[0, count)` and the executor returns to the caller
+ * only when all the jobs have been completed. The signature of the function
+ * call operator of an executor should be equivalent to the following:
+ *
+ * @code{.cpp}
+ * void(std::size_t count, Job job);
+ * @endcode
+ *
+ * The calling thread takes part in the work. Workers are created once during
+ * construction and put to sleep between two consecutive batches of jobs.
+ *
+ * Views and groups use executors to iterate entities and components in
+ * parallel. The function objects they are given are invoked concurrently from
+ * different threads and must be safe to call that way. They can freely read
+ * and update the components of the entity they receive and read components of
+ * any other type that no one modifies concurrently. Creating or destroying
+ * entities, assigning, replacing or removing components and tags, sorting pools
+ * and connecting or disconnecting listeners result in undefined behavior.
+ *
+ * @warning
+ * A thread pool runs a batch of jobs at a time. Invoking the function call
+ * operator from within a job or concurrently from different threads results in
+ * undefined behavior.<br/>
+ * Jobs must not throw exceptions.
+ */
+class ThreadPool final {
+    using invoke_type = void(void *, std::size_t);
+
+    void run() {
+        for(auto pos = next++; pos < total; pos = next++) {
+            invoke(instance, pos);
+        }
+    }
+
+    void work() {
+        std::unique_lock<std::mutex> lock{mutex};
+        // workers are spawned before any batch, they must not miss the first one
+        size_type batch{};
+
+        while(true) {
+            wakeup.wait(lock, [this, batch]() { return stop || batch != generation; });
+
+            if(stop) {
+                break;
+            }
+
+            batch = generation;
+            lock.unlock();
+            run();
+            lock.lock();
+
+            if(!--pending) {
+                done.notify_one();
+            }
+        }
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a thread pool and spawns its workers.
+     *
+     * By default, the calling thread and the workers together make as many
+     * threads as the hardware can run concurrently.
+     *
+     * @param count Number of workers to spawn.
+     */
+    explicit ThreadPool(const size_type count = std::max(1u, std::thread::hardware_concurrency()) - 1) {
+        workers.reserve(count);
+
+        for(size_type pos{}; pos < count; ++pos) {
+            workers.emplace_back(&ThreadPool::work, this);
+        }
+    }
+
+    /*! @brief Stops and joins all the workers. */
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            stop = true;
+        }
+
+        wakeup.notify_all();
+
+        for(auto &&worker: workers) {
+            worker.join();
+        }
+    }
+
+    /*! @brief Copying a thread pool isn't allowed. */
+    ThreadPool(const ThreadPool &) = delete;
+    /*! @brief Moving a thread pool isn't allowed. */
+    ThreadPool(ThreadPool &&) = delete;
+
+    /*! @brief Copying a thread pool isn't allowed. @return This thread pool. */
+    ThreadPool & operator=(const ThreadPool &) = delete;
+    /*! @brief Moving a thread pool isn't allowed. @return This thread pool. */
+    ThreadPool & operator=(ThreadPool &&) = delete;
+
+    /**
+     * @brief Returns the number of workers of a thread pool.
+     * @return Number of workers, the calling thread excluded.
+     */
+    size_type size() const ENTT_NOEXCEPT {
+        return workers.size();
+    }
+
+    /**
+     * @brief Runs a batch of jobs and waits for their completion.
+     *
+     * The function object is invoked once for each index in the range
+     * `[0, count)`, possibly concurrently from different threads. Therefore
+     * it must be safe to invoke it concurrently.<br/>
+     * The signature of the function object should be equivalent to the
+     * following:
+     *
+     * @code{.cpp}
+     * void(std::size_t);
+     * @endcode
+     *
+     * @tparam Job Type of function object to invoke.
+     * @param count Number of jobs to run.
+     * @param job A valid function object.
+     */
+    template<typename Job>
+    void operator()(const size_type count, Job job) {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            instance = &job;
+            invoke = [](void *ptr, const size_type pos) { (*static_cast<Job *>(ptr))(pos); };
+            total = count;
+            next = 0;
+            pending = workers.size();
+            ++generation;
+        }
+
+        wakeup.notify_all();
+        run();
+
+        std::unique_lock<std::mutex> lock{mutex};
+        done.wait(lock, [this]() { return !pending; });
+    }
+
+private:
+    std::vector<std::thread> workers;
+    std::condition_variable wakeup;
+    std::condition_variable done;
+    std::mutex mutex;
+    std::atomic<size_type> next{};
+    invoke_type *invoke{};
+    void *instance{};
+    size_type total{};
+    size_type pending{};
+    size_type generation{};
+    bool stop{};
+};
+
+
+}
+
+
+#endif // ENTT_CORE_EXECUTOR_HPP
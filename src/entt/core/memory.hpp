@@ -0,0 +1,513 @@
+#ifndef ENTT_CORE_MEMORY_HPP
+#define ENTT_CORE_MEMORY_HPP
+
+
+#include <new>
+#include <memory>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+#include "../config/config.h"
+
+
+namespace entt {
+
+
+/**
+ * @brief Polymorphic memory resource.
+ *
+ * A memory resource is the source of the memory used by sparse sets, registries
+ * and their internal data structures. It mimics the interface of the memory
+ * resources of the standard library, that aren't available before C++17.<br/>
+ * Derived classes must override the private virtual member functions.
+ */
+class MemoryResource {
+    virtual void * do_allocate(std::size_t, std::size_t) = 0;
+    virtual void do_deallocate(void *, std::size_t, std::size_t) = 0;
+
+    virtual bool do_is_equal(const MemoryResource &other) const ENTT_NOEXCEPT {
+        return this == &other;
+    }
+
+public:
+    /*! @brief Default destructor. */
+    virtual ~MemoryResource() = default;
+
+    /**
+     * @brief Allocates storage.
+     * @param bytes Size of the storage to allocate, in bytes.
+     * @param alignment Alignment of the storage, a power of two.
+     * @return A pointer to the allocated storage.
+     */
+    void * allocate(const std::size_t bytes, const std::size_t alignment = alignof(std::max_align_t)) {
+        return do_allocate(bytes, alignment);
+    }
+
+    /**
+     * @brief Deallocates storage previously allocated from this resource.
+     * @param ptr A pointer to the storage to deallocate.
+     * @param bytes Size of the storage, in bytes.
+     * @param alignment Alignment of the storage.
+     */
+    void deallocate(void *ptr, const std::size_t bytes, const std::size_t alignment = alignof(std::max_align_t)) {
+        do_deallocate(ptr, bytes, alignment);
+    }
+
+    /**
+     * @brief Checks whether memory allocated from a resource can be deallocated
+     * from another resource.
+     * @param other A valid memory resource.
+     * @return True if the resources are interchangeable, false otherwise.
+     */
+    bool is_equal(const MemoryResource &other) const ENTT_NOEXCEPT {
+        return do_is_equal(other);
+    }
+};
+
+
+/**
+ * @brief Memory resource that uses the global operators `new` and `delete`.
+ *
+ * Over-aligned storage is obtained by over-allocating and it's supported also
+ * before C++17.
+ */
+class NewDeleteResource final: public MemoryResource {
+    void * do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+        if(alignment <= alignof(std::max_align_t)) {
+            return ::operator new(bytes);
+        }
+
+        // the original pointer is stored right before the aligned storage
+        auto *base = static_cast<unsigned char *>(::operator new(bytes + alignment + sizeof(void *)));
+        auto addr = reinterpret_cast<std::uintptr_t>(base + sizeof(void *));
+        auto *ptr = reinterpret_cast<unsigned char *>((addr + alignment - 1) & ~std::uintptr_t(alignment - 1));
+        *(reinterpret_cast<void **>(ptr) - 1) = base;
+        return ptr;
+    }
+
+    void do_deallocate(void *ptr, const std::size_t, const std::size_t alignment) override {
+        if(alignment <= alignof(std::max_align_t)) {
+            ::operator delete(ptr);
+        } else {
+            ::operator delete(*(static_cast<void **>(ptr) - 1));
+        }
+    }
+};
+
+
+/**
+ * @brief Returns the default memory resource.
+ * @return A pointer to a static instance of NewDeleteResource.
+ */
+inline MemoryResource * default_resource() ENTT_NOEXCEPT {
+    static NewDeleteResource resource;
+    return &resource;
+}
+
+
+/**
+ * @brief Monotonic memory resource.
+ *
+ * A monotonic resource carves allocations out of large chunks obtained from an
+ * upstream resource and never gives memory back until it's released or
+ * destroyed. Deallocating storage is a no-op. It's the tool of choice to put a
+ * registry with all its pools in an arena and to drop everything at once.
+ *
+ * @warning
+ * Releasing a monotonic resource while some objects still use the memory it
+ * allocated results in undefined behavior. Destroy registries and sparse sets
+ * before their resources.<br/>
+ * A monotonic resource isn't thread safe.
+ */
+class MonotonicResource final: public MemoryResource {
+    struct Chunk {
+        Chunk *next;
+        std::size_t size;
+    };
+
+    void * do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+        void *ptr = current;
+
+        if(!ptr || !std::align(alignment, bytes, ptr, space)) {
+            const auto size = std::max(next, sizeof(Chunk) + bytes + alignment);
+            auto *chunk = new (upstream->allocate(size)) Chunk{head, size};
+            head = chunk;
+            next = size * 2;
+            ptr = current = reinterpret_cast<unsigned char *>(chunk) + sizeof(Chunk);
+            space = size - sizeof(Chunk);
+            std::align(alignment, bytes, ptr, space);
+        }
+
+        current = static_cast<unsigned char *>(ptr) + bytes;
+        space -= bytes;
+        return ptr;
+    }
+
+    void do_deallocate(void *, std::size_t, std::size_t) override {}
+
+public:
+    /**
+     * @brief Constructs a monotonic resource.
+     * @param upstream The resource from which to obtain chunks of memory.
+     * @param size Size of the first chunk, in bytes.
+     */
+    explicit MonotonicResource(MemoryResource *upstream = default_resource(), const std::size_t size = ENTT_PAGE_SIZE) ENTT_NOEXCEPT
+        : upstream{upstream}, initial{size}, next{size}
+    {}
+
+    /*! @brief Gives all the chunks back to the upstream resource. */
+    ~MonotonicResource() {
+        release();
+    }
+
+    /*! @brief Copying a monotonic resource isn't allowed. */
+    MonotonicResource(const MonotonicResource &) = delete;
+    /*! @brief Copying a monotonic resource isn't allowed. @return This resource. */
+    MonotonicResource & operator=(const MonotonicResource &) = delete;
+
+    /**
+     * @brief Gives all the chunks back to the upstream resource at once.
+     *
+     * The resource can be used again after a call to `release`.
+     */
+    void release() {
+        while(head) {
+            auto *chunk = head;
+            head = chunk->next;
+            upstream->deallocate(chunk, chunk->size);
+        }
+
+        current = nullptr;
+        space = 0;
+        next = initial;
+    }
+
+    /**
+     * @brief Returns the upstream resource.
+     * @return A pointer to the upstream resource.
+     */
+    MemoryResource * upstream_resource() const ENTT_NOEXCEPT {
+        return upstream;
+    }
+
+private:
+    MemoryResource *upstream;
+    Chunk *head{};
+    void *current{};
+    std::size_t space{};
+    const std::size_t initial;
+    std::size_t next;
+};
+
+
+/**
+ * @brief Allocator that gets its memory from a memory resource.
+ *
+ * It's a valid allocator for the containers of the standard library. Copies
+ * of an allocator share the same resource and containers don't propagate their
+ * allocators on assignment, the same as polymorphic allocators do since C++17.
+ *
+ * @tparam Type Type of objects to allocate.
+ */
+template<typename Type>
+class Allocator {
+    template<typename>
+    friend class Allocator;
+
+public:
+    /*! @brief Type of objects to allocate. */
+    using value_type = Type;
+
+    /**
+     * @brief Constructs an allocator for the given resource.
+     * @param resource A valid memory resource.
+     */
+    Allocator(MemoryResource *resource = default_resource()) ENTT_NOEXCEPT
+        : memory{resource}
+    {}
+
+    /**
+     * @brief Constructs an allocator that shares the resource of another one.
+     * @tparam Other Type of objects allocated by the other allocator.
+     * @param other An allocator from which to get the resource.
+     */
+    template<typename Other>
+    Allocator(const Allocator<Other> &other) ENTT_NOEXCEPT
+        : memory{other.memory}
+    {}
+
+    /**
+     * @brief Allocates storage for the given number of objects.
+     * @param count Number of objects.
+     * @return A pointer to the allocated storage.
+     */
+    Type * allocate(const std::size_t count) {
+        return static_cast<Type *>(memory->allocate(count * sizeof(Type), alignof(Type)));
+    }
+
+    /**
+     * @brief Deallocates storage previously allocated with an equal allocator.
+     * @param ptr A pointer to the storage to deallocate.
+     * @param count Number of objects.
+     */
+    void deallocate(Type *ptr, const std::size_t count) {
+        memory->deallocate(ptr, count * sizeof(Type), alignof(Type));
+    }
+
+    /**
+     * @brief Returns the resource used by an allocator.
+     * @return A pointer to the memory resource.
+     */
+    MemoryResource * resource() const ENTT_NOEXCEPT {
+        return memory;
+    }
+
+private:
+    MemoryResource *memory;
+};
+
+
+/**
+ * @brief Compares two allocators.
+ * @tparam Lhs Type of objects allocated by the first allocator.
+ * @tparam Rhs Type of objects allocated by the second allocator.
+ * @param lhs A valid allocator.
+ * @param rhs A valid allocator.
+ * @return True if the allocators use interchangeable resources, false
+ * otherwise.
+ */
+template<typename Lhs, typename Rhs>
+bool operator==(const Allocator<Lhs> &lhs, const Allocator<Rhs> &rhs) ENTT_NOEXCEPT {
+    return lhs.resource() == rhs.resource() || lhs.resource()->is_equal(*rhs.resource());
+}
+
+
+/**
+ * @brief Compares two allocators.
+ * @tparam Lhs Type of objects allocated by the first allocator.
+ * @tparam Rhs Type of objects allocated by the second allocator.
+ * @param lhs A valid allocator.
+ * @param rhs A valid allocator.
+ * @return False if the allocators use interchangeable resources, true
+ * otherwise.
+ */
+template<typename Lhs, typename Rhs>
+inline bool operator!=(const Allocator<Lhs> &lhs, const Allocator<Rhs> &rhs) ENTT_NOEXCEPT {
+    return !(lhs == rhs);
+}
+
+
+/**
+ * @brief Allocator that gets over-aligned memory from a memory resource.
+ *
+ * Same as Allocator, but for the alignment of the storage, that is the
+ * greater between the given one and the one of the type of objects.
+ *
+ * @tparam Type Type of objects to allocate.
+ * @tparam Alignment Minimum alignment of the storage, a power of two.
+ */
+template<typename Type, std::size_t Alignment>
+class AlignedAllocator: public Allocator<Type> {
+    static_assert(Alignment && !(Alignment & (Alignment - 1)), "!");
+
+    static constexpr auto alignment = Alignment < alignof(Type) ? alignof(Type) : Alignment;
+
+public:
+    /**
+     * @brief Rebinds an allocator to another type of objects.
+     * @tparam Other Type of objects to allocate.
+     */
+    template<typename Other>
+    struct rebind {
+        /*! @brief Type of allocator for the given type of objects. */
+        using other = AlignedAllocator<Other, Alignment>;
+    };
+
+    /**
+     * @brief Constructs an allocator for the given resource.
+     * @param resource A valid memory resource.
+     */
+    AlignedAllocator(MemoryResource *resource = default_resource()) ENTT_NOEXCEPT
+        : Allocator<Type>{resource}
+    {}
+
+    /**
+     * @brief Constructs an allocator that shares the resource of another one.
+     * @tparam Other Type of objects allocated by the other allocator.
+     * @param other An allocator from which to get the resource.
+     */
+    template<typename Other>
+    AlignedAllocator(const Allocator<Other> &other) ENTT_NOEXCEPT
+        : Allocator<Type>{other.resource()}
+    {}
+
+    /**
+     * @brief Allocates storage for the given number of objects.
+     * @param count Number of objects.
+     * @return A pointer to the allocated storage.
+     */
+    Type * allocate(const std::size_t count) {
+        return static_cast<Type *>(this->resource()->allocate(count * sizeof(Type), alignment));
+    }
+
+    /**
+     * @brief Deallocates storage previously allocated with an equal allocator.
+     * @param ptr A pointer to the storage to deallocate.
+     * @param count Number of objects.
+     */
+    void deallocate(Type *ptr, const std::size_t count) {
+        this->resource()->deallocate(ptr, count * sizeof(Type), alignment);
+    }
+};
+
+
+/**
+ * @brief Deleter for objects created from a memory resource.
+ *
+ * The deleter remembers the size and the alignment of the actual type of the
+ * object, therefore pointers to derived classes can be safely converted to
+ * pointers to their base classes, as long as the latter have a virtual
+ * destructor.
+ *
+ * @tparam Type Type of objects to delete.
+ */
+template<typename Type>
+class ResourceDeleter {
+    template<typename>
+    friend class ResourceDeleter;
+
+public:
+    /*! @brief Default constructor, for empty pointers only. */
+    ResourceDeleter() ENTT_NOEXCEPT = default;
+
+    /**
+     * @brief Constructs a deleter for objects of the given type.
+     * @param resource The memory resource used to create the objects.
+     */
+    explicit ResourceDeleter(MemoryResource *resource) ENTT_NOEXCEPT
+        : memory{resource}, size{sizeof(Type)}, alignment{alignof(Type)}
+    {}
+
+    /**
+     * @brief Constructs a deleter from the deleter of a derived class.
+     * @tparam Other Type of objects deleted by the other deleter.
+     * @param other A valid deleter.
+     */
+    template<typename Other, typename = std::enable_if_t<std::is_convertible<Other *, Type *>::value>>
+    ResourceDeleter(const ResourceDeleter<Other> &other) ENTT_NOEXCEPT
+        : memory{other.memory}, size{other.size}, alignment{other.alignment}
+    {}
+
+    /**
+     * @brief Destroys an object and gives its storage back to the resource.
+     * @param ptr A pointer to an object created from the resource.
+     */
+    void operator()(Type *ptr) const {
+        ptr->~Type();
+        memory->deallocate(ptr, size, alignment);
+    }
+
+private:
+    MemoryResource *memory{};
+    std::size_t size{};
+    std::size_t alignment{};
+};
+
+
+/**
+ * @brief Deleter for arrays created from a memory resource.
+ * @tparam Type Type of elements of the arrays to delete.
+ */
+template<typename Type>
+class ResourceDeleter<Type[]> {
+public:
+    /*! @brief Default constructor, for empty pointers only. */
+    ResourceDeleter() ENTT_NOEXCEPT = default;
+
+    /**
+     * @brief Constructs a deleter for arrays with the given number of elements.
+     * @param resource The memory resource used to create the arrays.
+     * @param count Number of elements of the arrays.
+     */
+    ResourceDeleter(MemoryResource *resource, const std::size_t count) ENTT_NOEXCEPT
+        : memory{resource}, count{count}
+    {}
+
+    /**
+     * @brief Destroys the elements of an array and gives its storage back to
+     * the resource.
+     * @param ptr A pointer to an array created from the resource.
+     */
+    void operator()(Type *ptr) const {
+        for(auto pos = count; pos; --pos) {
+            ptr[pos-1].~Type();
+        }
+
+        memory->deallocate(ptr, count * sizeof(Type), alignof(Type));
+    }
+
+private:
+    MemoryResource *memory{};
+    std::size_t count{};
+};
+
+
+/**
+ * @brief Unique pointer to an object created from a memory resource.
+ * @tparam Type Type of object, either a complete type or an array.
+ */
+template<typename Type>
+using ResourcePtr = std::unique_ptr<Type, ResourceDeleter<Type>>;
+
+
+/**
+ * @brief Creates an object from a memory resource.
+ * @tparam Type Type of object to create.
+ * @tparam Args Types of arguments to use to construct the object.
+ * @param resource A valid memory resource.
+ * @param args Parameters to use to construct the object.
+ * @return A unique pointer that gives the storage back to the resource.
+ */
+template<typename Type, typename... Args>
+std::enable_if_t<!std::is_array<Type>::value, ResourcePtr<Type>>
+allocate_unique(MemoryResource *resource, Args &&... args) {
+    void *ptr = resource->allocate(sizeof(Type), alignof(Type));
+
+    try {
+        return ResourcePtr<Type>{new (ptr) Type{std::forward<Args>(args)...}, ResourceDeleter<Type>{resource}};
+    } catch(...) {
+        resource->deallocate(ptr, sizeof(Type), alignof(Type));
+        throw;
+    }
+}
+
+
+/**
+ * @brief Creates an array of value-initialized elements from a memory
+ * resource.
+ * @tparam Type Type of array to create, an array of unknown bound.
+ * @param resource A valid memory resource.
+ * @param count Number of elements of the array.
+ * @return A unique pointer that gives the storage back to the resource.
+ */
+template<typename Type>
+std::enable_if_t<std::is_array<Type>::value && !std::extent<Type>::value, ResourcePtr<Type>>
+allocate_unique(MemoryResource *resource, const std::size_t count) {
+    using element_type = std::remove_extent_t<Type>;
+    static_assert(std::is_nothrow_default_constructible<element_type>::value, "!");
+    auto *ptr = static_cast<element_type *>(resource->allocate(count * sizeof(element_type), alignof(element_type)));
+
+    for(std::size_t pos{}; pos < count; ++pos) {
+        new (ptr + pos) element_type{};
+    }
+
+    return ResourcePtr<Type>{ptr, ResourceDeleter<Type>{resource, count}};
+}
+
+
+}
+
+
+#endif // ENTT_CORE_MEMORY_HPP
@@ -0,0 +1,192 @@
+#ifndef ENTT_ENTITY_ARCHIVE_HPP
+#define ENTT_ENTITY_ARCHIVE_HPP
+
+
+#include <cstddef>
+#include <cstring>
+#include <cassert>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include "../config/config.h"
+
+
+namespace entt {
+
+
+/**
+ * @brief Binary output archive.
+ *
+ * Built-in output archive that writes the raw bytes of entities, components
+ * and tags to a stream. It supports only trivially copyable types and doesn't
+ * care about endianness nor about the size of the types, therefore it's meant
+ * to be read back on the same platform.<br/>
+ * Snapshots write whole pools at once through the `block` member function when
+ * components are trivially copyable and stored in plain arrays.
+ */
+class BinaryOutputArchive final {
+public:
+    /**
+     * @brief Constructs an archive that writes to the given stream.
+     * @param stream A valid output stream, open in binary mode.
+     */
+    explicit BinaryOutputArchive(std::ostream &stream) ENTT_NOEXCEPT
+        : stream{stream}
+    {}
+
+    /**
+     * @brief Writes the given values one after the other.
+     * @tparam Type Types of values to write.
+     * @param value Values to write.
+     */
+    template<typename... Type>
+    void operator()(const Type &... value) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (block(&value, 1), 0)... };
+        (void)accumulator;
+    }
+
+    /**
+     * @brief Writes an array of values at once.
+     * @tparam Type Type of values to write.
+     * @param data A pointer to the first element of the array.
+     * @param count Number of elements to write.
+     */
+    template<typename Type>
+    void block(const Type *data, const std::size_t count) {
+        static_assert(std::is_trivially_copyable<Type>::value, "!");
+        stream.write(reinterpret_cast<const char *>(data), count * sizeof(Type));
+    }
+
+private:
+    std::ostream &stream;
+};
+
+
+/**
+ * @brief Binary input archive.
+ *
+ * Built-in input archive that reads back what a binary output archive wrote.
+ * It supports only trivially copyable types.<br/>
+ * Loaders read whole pools at once through the `block` member function when
+ * components are trivially copyable and stored in plain arrays.
+ */
+class BinaryInputArchive final {
+public:
+    /**
+     * @brief Constructs an archive that reads from the given stream.
+     * @param stream A valid input stream, open in binary mode.
+     */
+    explicit BinaryInputArchive(std::istream &stream) ENTT_NOEXCEPT
+        : stream{stream}
+    {}
+
+    /**
+     * @brief Reads the given values one after the other.
+     * @tparam Type Types of values to read.
+     * @param value Values to read.
+     */
+    template<typename... Type>
+    void operator()(Type &... value) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (block(&value, 1), 0)... };
+        (void)accumulator;
+    }
+
+    /**
+     * @brief Reads an array of values at once.
+     * @tparam Type Type of values to read.
+     * @param data A pointer to the first element of the array.
+     * @param count Number of elements to read.
+     */
+    template<typename Type>
+    void block(Type *data, const std::size_t count) {
+        static_assert(std::is_trivially_copyable<Type>::value, "!");
+        stream.read(reinterpret_cast<char *>(data), count * sizeof(Type));
+    }
+
+private:
+    std::istream &stream;
+};
+
+
+/**
+ * @brief Binary input archive for contiguous memory.
+ *
+ * Built-in input archive that reads back what a binary output archive wrote,
+ * directly from a buffer. It's meant to be used with snapshots loaded or
+ * mapped in memory as a whole, so as to restore them without going through a
+ * stream. Arrays of values are copied with a single call to `memcpy`.<br/>
+ * It supports only trivially copyable types.
+ *
+ * @warning
+ * The buffer isn't copied. Its lifetime mustn't be shorter than the one of the
+ * archive.
+ */
+class MemoryInputArchive final {
+public:
+    /**
+     * @brief Constructs an archive that reads from the given buffer.
+     * @param data A pointer to the first byte of the buffer.
+     * @param size Size of the buffer in bytes.
+     */
+    MemoryInputArchive(const void *data, const std::size_t size) ENTT_NOEXCEPT
+        : curr{static_cast<const char *>(data)},
+          last{curr + size}
+    {}
+
+    /**
+     * @brief Reads the given values one after the other.
+     * @tparam Type Types of values to read.
+     * @param value Values to read.
+     */
+    template<typename... Type>
+    void operator()(Type &... value) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (block(&value, 1), 0)... };
+        (void)accumulator;
+    }
+
+    /**
+     * @brief Reads an array of values at once.
+     *
+     * @warning
+     * Attempting to read past the end of the buffer results in undefined
+     * behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if there
+     * aren't enough bytes left.
+     *
+     * @tparam Type Type of values to read.
+     * @param data A pointer to the first element of the array.
+     * @param count Number of elements to read.
+     */
+    template<typename Type>
+    void block(Type *data, const std::size_t count) {
+        static_assert(std::is_trivially_copyable<Type>::value, "!");
+        const auto bytes = count * sizeof(Type);
+        assert(bytes <= remaining());
+
+        if(bytes) {
+            std::memcpy(data, curr, bytes);
+            curr += bytes;
+        }
+    }
+
+    /**
+     * @brief Returns the number of bytes not yet read.
+     * @return Number of bytes not yet read.
+     */
+    std::size_t remaining() const ENTT_NOEXCEPT {
+        return std::size_t(last - curr);
+    }
+
+private:
+    const char *curr;
+    const char *last;
+};
+
+
+}
+
+
+#endif // ENTT_ENTITY_ARCHIVE_HPP
@@ -0,0 +1,404 @@
+#ifndef ENTT_ENTITY_COMMAND_BUFFER_HPP
+#define ENTT_ENTITY_COMMAND_BUFFER_HPP
+
+
+#include <new>
+#include <mutex>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+#include "../config/config.h"
+#include "registry.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Command buffer for deferred changes to a registry.
+ *
+ * A command buffer records the creation and destruction of entities as well
+ * as the assignment, replacement and removal of components, then it plays all
+ * of them back into a registry at once. It's the tool of choice to modify a
+ * registry from within an iteration or from different threads, when doing it
+ * directly would invalidate iterators or result in data races.
+ *
+ * Each thread records its commands in a dedicated lane, so that commands can
+ * be recorded concurrently without contention. Components are constructed
+ * when commands are recorded and kept in a linear arena that is reused once
+ * the commands have been played back.<br/>
+ * Entities created through a command buffer don't exist until the commands are
+ * played back. Placeholders are returned in their place and they can be used
+ * to assign components to the entities to be created.
+ *
+ * During playback, entities are created first and all at once. Then
+ * components are assigned, replaced and removed one type at a time, so as to
+ * visit each pool only once. The commands for the same type of component that
+ * were recorded by the same thread are played back in the order in which they
+ * were recorded. Finally, entities are destroyed.
+ *
+ * @warning
+ * Recording commands and playing them back concurrently results in undefined
+ * behavior. The same applies to the other member functions of a command
+ * buffer, recording functions and `create` excluded.<br/>
+ * Commands are subject to the same preconditions of the corresponding member
+ * functions of the registry, checked when they are played back.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class CommandBuffer final {
+    using registry_type = Registry<Entity>;
+    using component_type = typename registry_type::component_type;
+    using apply_fn_type = void(registry_type &, const Entity, void *);
+    using dispose_fn_type = void(void *);
+
+    struct Command {
+        apply_fn_type *apply;
+        dispose_fn_type *dispose;
+        void *payload;
+        component_type ctype;
+        Entity entity;
+        bool deferred;
+    };
+
+    struct Block {
+        std::unique_ptr<unsigned char[]> data;
+        std::size_t capacity;
+    };
+
+    struct Lane {
+        void * allocate(const std::size_t size, const std::size_t alignment) {
+            void *ptr = nullptr;
+
+            while(!ptr) {
+                if(block == blocks.size()) {
+                    const auto capacity = std::max<std::size_t>(ENTT_PAGE_SIZE, size + alignment);
+                    blocks.push_back(Block{std::unique_ptr<unsigned char[]>{new unsigned char[capacity]}, capacity});
+                }
+
+                auto space = blocks[block].capacity - offset;
+                ptr = blocks[block].data.get() + offset;
+
+                if(std::align(alignment, size, ptr, space)) {
+                    offset = blocks[block].capacity - space + size;
+                } else {
+                    ptr = nullptr;
+                    offset = 0;
+                    ++block;
+                }
+            }
+
+            return ptr;
+        }
+
+        void clear() {
+            for(auto &&command: commands) {
+                if(command.dispose) {
+                    command.dispose(command.payload);
+                }
+            }
+
+            commands.clear();
+            destroyed.clear();
+            block = 0;
+            offset = 0;
+        }
+
+        std::thread::id owner;
+        std::vector<Command> commands;
+        std::vector<Entity> destroyed;
+        std::vector<Block> blocks;
+        std::size_t block{};
+        std::size_t offset{};
+    };
+
+    template<typename Component>
+    static void assigning(registry_type &registry, const Entity entity, void *payload) {
+        registry.template assign<Component>(entity, std::move(*static_cast<Component *>(payload)));
+    }
+
+    template<typename Component>
+    static void replacing(registry_type &registry, const Entity entity, void *payload) {
+        registry.template replace<Component>(entity, std::move(*static_cast<Component *>(payload)));
+    }
+
+    template<typename Component>
+    static void removing(registry_type &registry, const Entity entity, void *) {
+        registry.template remove<Component>(entity);
+    }
+
+    template<typename Component>
+    static void disposing(void *payload) {
+        static_cast<Component *>(payload)->~Component();
+    }
+
+    static std::size_t identifier() ENTT_NOEXCEPT {
+        static std::atomic<std::size_t> counter{};
+        return ++counter;
+    }
+
+    Lane & lane() {
+        // lanes are never released before the command buffer, the cache is safe until then
+        static thread_local std::pair<std::size_t, Lane *> cache{};
+
+        if(cache.first != serial) {
+            std::lock_guard<std::mutex> lock{mutex};
+            const auto id = std::this_thread::get_id();
+
+            auto it = std::find_if(lanes.begin(), lanes.end(), [id](const auto &curr) {
+                return curr->owner == id;
+            });
+
+            if(it == lanes.end()) {
+                lanes.push_back(std::make_unique<Lane>());
+                lanes.back()->owner = id;
+                it = lanes.end() - 1;
+            }
+
+            cache = { serial, it->get() };
+        }
+
+        return *cache.second;
+    }
+
+    template<typename Component, typename... Args>
+    void record(apply_fn_type *apply, const Entity entity, const bool deferred, Args &&... args) {
+        auto &curr = lane();
+        void *payload = curr.allocate(sizeof(Component), alignof(Component));
+        new (payload) Component{std::forward<Args>(args)...};
+        dispose_fn_type *dispose = std::is_trivially_destructible<Component>::value ? nullptr : &disposing<Component>;
+        curr.commands.push_back(Command{apply, dispose, payload, registry_type::template type<Component>(), entity, deferred});
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Placeholder for an entity to be created during playback.
+     *
+     * Placeholders can be used only with the command buffer that generated
+     * them and until its commands are played back or cleared.
+     */
+    class Placeholder final {
+        /*! @brief A command buffer is allowed to create placeholders. */
+        friend class CommandBuffer;
+
+        explicit Placeholder(const entity_type index) ENTT_NOEXCEPT
+            : index{index}
+        {}
+
+        entity_type index;
+    };
+
+    /*! @brief Default constructor. */
+    CommandBuffer()
+        : serial{identifier()}
+    {}
+
+    /*! @brief Destroys the components of the pending commands, if any. */
+    ~CommandBuffer() {
+        clear();
+    }
+
+    /*! @brief Copying a command buffer isn't allowed. */
+    CommandBuffer(const CommandBuffer &) = delete;
+    /*! @brief Moving a command buffer isn't allowed. */
+    CommandBuffer(CommandBuffer &&) = delete;
+
+    /*! @brief Copying a command buffer isn't allowed. @return This command buffer. */
+    CommandBuffer & operator=(const CommandBuffer &) = delete;
+    /*! @brief Moving a command buffer isn't allowed. @return This command buffer. */
+    CommandBuffer & operator=(CommandBuffer &&) = delete;
+
+    /**
+     * @brief Returns the number of pending commands.
+     * @return Number of pending commands.
+     */
+    size_type size() const ENTT_NOEXCEPT {
+        size_type sz = created;
+
+        for(auto &&curr: lanes) {
+            sz += curr->commands.size() + curr->destroyed.size();
+        }
+
+        return sz;
+    }
+
+    /**
+     * @brief Checks whether a command buffer has pending commands.
+     * @return True if there are no pending commands, false otherwise.
+     */
+    bool empty() const ENTT_NOEXCEPT {
+        return !size();
+    }
+
+    /**
+     * @brief Records the creation of an entity.
+     *
+     * The returned placeholder can be used to assign components to the entity
+     * before it's created.
+     *
+     * @return A placeholder for the entity to be created.
+     */
+    Placeholder create() ENTT_NOEXCEPT {
+        return Placeholder{entity_type(created++)};
+    }
+
+    /**
+     * @brief Records the destruction of an entity.
+     *
+     * Entities are destroyed after all the other commands have been played
+     * back. Destroying the same entity more than once from the same command
+     * buffer is allowed, the entity is destroyed only once.
+     *
+     * @param entity A valid entity identifier.
+     */
+    void destroy(const entity_type entity) {
+        lane().destroyed.push_back(entity);
+    }
+
+    /**
+     * @brief Records the assignment of a component to an entity.
+     *
+     * The component is constructed immediately and moved into the registry
+     * during playback.
+     *
+     * @tparam Component Type of component to assign.
+     * @tparam Args Types of arguments to use to construct the component.
+     * @param entity A valid entity identifier.
+     * @param args Parameters to use to initialize the component.
+     */
+    template<typename Component, typename... Args>
+    void assign(const entity_type entity, Args &&... args) {
+        record<Component>(&assigning<Component>, entity, false, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Records the assignment of a component to an entity to be created.
+     *
+     * The component is constructed immediately and moved into the registry
+     * during playback.
+     *
+     * @tparam Component Type of component to assign.
+     * @tparam Args Types of arguments to use to construct the component.
+     * @param placeholder A placeholder returned by this command buffer.
+     * @param args Parameters to use to initialize the component.
+     */
+    template<typename Component, typename... Args>
+    void assign(const Placeholder placeholder, Args &&... args) {
+        record<Component>(&assigning<Component>, placeholder.index, true, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Records the replacement of a component of an entity.
+     *
+     * The component is constructed immediately and moved into the registry
+     * during playback.
+     *
+     * @tparam Component Type of component to replace.
+     * @tparam Args Types of arguments to use to construct the component.
+     * @param entity A valid entity identifier.
+     * @param args Parameters to use to initialize the component.
+     */
+    template<typename Component, typename... Args>
+    void replace(const entity_type entity, Args &&... args) {
+        record<Component>(&replacing<Component>, entity, false, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Records the removal of a component from an entity.
+     * @tparam Component Type of component to remove.
+     * @param entity A valid entity identifier.
+     */
+    template<typename Component>
+    void remove(const entity_type entity) {
+        lane().commands.push_back(Command{&removing<Component>, nullptr, nullptr, registry_type::template type<Component>(), entity, false});
+    }
+
+    /**
+     * @brief Plays back all the pending commands into a registry.
+     *
+     * Entities are created first, then commands are applied one type of
+     * component at a time and entities are destroyed last. The command buffer
+     * is cleared afterwards and it can be reused.
+     *
+     * @param registry A valid reference to a registry.
+     */
+    void playback(registry_type &registry) {
+        std::vector<entity_type> spawned(created);
+        registry.create(spawned.begin(), spawned.end());
+
+        std::vector<Command *> pending;
+        std::vector<entity_type> destroyed;
+
+        for(auto &&curr: lanes) {
+            for(auto &&command: curr->commands) {
+                pending.push_back(&command);
+            }
+
+            destroyed.insert(destroyed.end(), curr->destroyed.cbegin(), curr->destroyed.cend());
+        }
+
+        std::stable_sort(pending.begin(), pending.end(), [](const auto *lhs, const auto *rhs) {
+            return lhs->ctype < rhs->ctype;
+        });
+
+        for(const auto *command: pending) {
+            command->apply(registry, command->deferred ? spawned[command->entity] : command->entity, command->payload);
+        }
+
+        std::sort(destroyed.begin(), destroyed.end());
+        destroyed.erase(std::unique(destroyed.begin(), destroyed.end()), destroyed.end());
+
+        for(const auto entity: destroyed) {
+            registry.destroy(entity);
+        }
+
+        clear();
+    }
+
+    /**
+     * @brief Discards all the pending commands.
+     *
+     * Components constructed when commands were recorded are destroyed. The
+     * memory of the command buffer is kept for later use.
+     */
+    void clear() {
+        for(auto &&curr: lanes) {
+            curr->clear();
+        }
+
+        created = 0;
+    }
+
+private:
+    std::vector<std::unique_ptr<Lane>> lanes;
+    std::mutex mutex;
+    std::atomic<size_type> created{};
+    const std::size_t serial;
+};
+
+
+/**
+ * @brief Default command buffer.
+ *
+ * The default command buffer is the best choice for almost all the
+ * applications.<br/>
+ * Users should have a really good reason to choose something different.
+ */
+using DefaultCommandBuffer = CommandBuffer<DefaultRegistry::entity_type>;
+
+
+}
+
+
+#endif // ENTT_ENTITY_COMMAND_BUFFER_HPP
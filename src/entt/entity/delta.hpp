@@ -0,0 +1,323 @@
+#ifndef ENTT_ENTITY_DELTA_HPP
+#define ENTT_ENTITY_DELTA_HPP
+
+
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <algorithm>
+#include "../config/config.h"
+#include "registry.hpp"
+#include "snapshot.hpp"
+#include "sparse_set.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Recorder of changes to serialize as delta snapshots.
+ *
+ * A delta records what happens to the components it observes between two
+ * calls to `clear`: the entities whose components have been constructed or
+ * updated, the components that have been removed and the entities that have
+ * been destroyed meanwhile. It serializes only them, so that bandwidth and
+ * time spent to keep two registries in sync scale with the number of changes
+ * and not with the size of the world.<br/>
+ * Deltas are meant to be applied to a registry that received a snapshot or
+ * a delta already, by means of a continuous loader.
+ *
+ * The following is an example of use:
+ *
+ * @code{.cpp}
+ * delta.entities(output).destroyed(output).component<Position, Velocity>(output);
+ * delta.clear();
+ * @endcode
+ *
+ * @note
+ * Entities are recorded through the signals of the components observed.
+ * Entities referred by data members of components must be known to the
+ * continuous loader, that is, they must have been sent already or be part of
+ * the same delta.
+ *
+ * @warning
+ * Lifetime of a delta mustn't overcome the one of the registry it's connected
+ * to. In any other case, the delta results in undefined behavior when it's
+ * destroyed.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class Delta final {
+    using view_type = SparseSet<Entity>;
+    using disconnect_fn_type = void(Registry<Entity> &, Delta *);
+
+    struct Pool {
+        explicit Pool(MemoryResource *resource)
+            : changed{resource},
+              removed{resource},
+              disconnect{nullptr}
+        {}
+
+        view_type changed;
+        view_type removed;
+        disconnect_fn_type *disconnect;
+    };
+
+    static void record(view_type &set, const Entity entity) {
+        if(set.has(entity)) {
+            // identifiers are recycled, a newer version replaces the old one
+            if(set.data()[set.get(entity)] != entity) {
+                set.destroy(entity);
+                set.construct(entity);
+            }
+        } else {
+            set.construct(entity);
+        }
+    }
+
+    static void forget(view_type &set, const Entity entity) {
+        if(set.has(entity)) {
+            set.destroy(entity);
+        }
+    }
+
+    template<typename Component>
+    static void disconnecting(Registry<Entity> &registry, Delta *delta) {
+        registry.template construction<Component>().disconnect(delta);
+        registry.template update<Component>().disconnect(delta);
+        registry.template destruction<Component>().disconnect(delta);
+    }
+
+    template<typename Component>
+    void changing(Registry<Entity> &, const Entity entity) {
+        auto &pool = pools[Registry<Entity>::template type<Component>()];
+        record(pool.changed, entity);
+        forget(pool.removed, entity);
+        record(touched, entity);
+    }
+
+    template<typename Component>
+    void removing(Registry<Entity> &, const Entity entity) {
+        auto &pool = pools[Registry<Entity>::template type<Component>()];
+        forget(pool.changed, entity);
+        record(pool.removed, entity);
+
+        // the oldest version is the one known to the other side
+        if(!gone.has(entity)) {
+            gone.construct(entity);
+        }
+    }
+
+    template<typename Component>
+    void observe() {
+        const auto ctype = Registry<Entity>::template type<Component>();
+
+        while(!(ctype < pools.size())) {
+            pools.emplace_back(registry.resource());
+        }
+
+        if(!pools[ctype].disconnect) {
+            pools[ctype].disconnect = &disconnecting<Component>;
+            registry.template construction<Component>().template connect<Delta, &Delta::changing<Component>>(this);
+            registry.template update<Component>().template connect<Delta, &Delta::changing<Component>>(this);
+            registry.template destruction<Component>().template connect<Delta, &Delta::removing<Component>>(this);
+        }
+    }
+
+    template<typename Component>
+    const Pool & pool() const ENTT_NOEXCEPT {
+        const auto ctype = Registry<Entity>::template type<Component>();
+        assert(ctype < pools.size());
+        return pools[ctype];
+    }
+
+    template<typename Component, typename Archive>
+    void put(Archive &archive) const {
+        const auto &curr = pool<Component>();
+        registry.snapshot().template component<Component>(archive, curr.changed.cbegin(), curr.changed.cend());
+        serialize(archive, curr.removed, [this](const auto entity) { return registry.valid(entity); });
+    }
+
+    template<typename Archive, typename Func>
+    void serialize(Archive &archive, const view_type &set, Func func) const {
+        std::vector<Entity> entities;
+        entities.reserve(set.size());
+        std::copy_if(set.cbegin(), set.cend(), std::back_inserter(entities), std::move(func));
+
+        archive(static_cast<Entity>(entities.size()));
+
+        for(const auto entity: entities) {
+            archive(entity);
+        }
+    }
+
+public:
+    /*! @brief Type of registry to which a delta is connected. */
+    using registry_type = Registry<Entity>;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename view_type::entity_type;
+
+    /**
+     * @brief Constructs a delta for the given registry.
+     *
+     * The delta gets its memory from the resource of the registry and it
+     * doesn't observe any component until `connect` is invoked.
+     *
+     * @param registry A valid registry.
+     */
+    explicit Delta(registry_type &registry)
+        : touched{registry.resource()},
+          gone{registry.resource()},
+          registry{registry}
+    {}
+
+    /*! @brief Disconnects the delta from the registry. */
+    ~Delta() {
+        disconnect();
+    }
+
+    /*! @brief Copying a delta isn't allowed. */
+    Delta(const Delta &) = delete;
+    /*! @brief Moving a delta isn't allowed. */
+    Delta(Delta &&) = delete;
+
+    /*! @brief Copying a delta isn't allowed. @return This delta. */
+    Delta & operator=(const Delta &) = delete;
+    /*! @brief Moving a delta isn't allowed. @return This delta. */
+    Delta & operator=(Delta &&) = delete;
+
+    /**
+     * @brief Starts observing the given components.
+     *
+     * Components that are already observed are ignored.
+     *
+     * @tparam Component Types of components to observe.
+     */
+    template<typename... Component>
+    void connect() {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (observe<Component>(), 0)... };
+        (void)accumulator;
+    }
+
+    /**
+     * @brief Stops observing all the components.
+     *
+     * Changes already recorded are kept until the delta is cleared.
+     */
+    void disconnect() {
+        for(auto &&curr: pools) {
+            if(curr.disconnect) {
+                curr.disconnect(registry, this);
+                curr.disconnect = nullptr;
+            }
+        }
+    }
+
+    /**
+     * @brief Checks whether nothing changed.
+     * @return True if nothing changed, false otherwise.
+     */
+    bool empty() const ENTT_NOEXCEPT {
+        return touched.empty() && gone.empty();
+    }
+
+    /**
+     * @brief Puts aside the entities whose components changed.
+     *
+     * Entities are serialized along with their versions, in the same format
+     * used by snapshots. Entities destroyed meanwhile are not taken in
+     * consideration by this function.
+     *
+     * @tparam Archive Type of output archive.
+     * @param archive A valid reference to an output archive.
+     * @return An object of this type to continue creating the delta.
+     */
+    template<typename Archive>
+    const Delta & entities(Archive &archive) const {
+        serialize(archive, touched, [this](const auto entity) { return registry.valid(entity); });
+        return *this;
+    }
+
+    /**
+     * @brief Puts aside the entities destroyed meanwhile.
+     *
+     * Only entities that owned at least one of the components observed are
+     * taken in consideration by this function.
+     *
+     * @tparam Archive Type of output archive.
+     * @param archive A valid reference to an output archive.
+     * @return An object of this type to continue creating the delta.
+     */
+    template<typename Archive>
+    const Delta & destroyed(Archive &archive) const {
+        serialize(archive, gone, [this](const auto entity) { return !registry.valid(entity); });
+        return *this;
+    }
+
+    /**
+     * @brief Puts aside the changes to the given components.
+     *
+     * For each component, instances constructed or updated meanwhile are
+     * serialized together with the entities to which they belong, in the same
+     * format used by snapshots. Then follow the entities from which the
+     * component has been removed, if they are still valid.
+     *
+     * @warning
+     * Attempting to serialize a component that has never been observed results
+     * in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * the component has never been observed.
+     *
+     * @tparam Component Types of components to serialize.
+     * @tparam Archive Type of output archive.
+     * @param archive A valid reference to an output archive.
+     * @return An object of this type to continue creating the delta.
+     */
+    template<typename... Component, typename Archive>
+    const Delta & component(Archive &archive) const {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (put<Component>(archive), 0)... };
+        (void)accumulator;
+        return *this;
+    }
+
+    /**
+     * @brief Forgets all the changes recorded so far.
+     *
+     * The delta keeps observing the same components. Usually, it's invoked
+     * once the changes have been serialized.
+     */
+    void clear() {
+        for(auto &&curr: pools) {
+            curr.changed.reset();
+            curr.removed.reset();
+        }
+
+        touched.reset();
+        gone.reset();
+    }
+
+private:
+    std::vector<Pool> pools;
+    view_type touched;
+    view_type gone;
+    registry_type &registry;
+};
+
+
+/**
+ * @brief Default delta.
+ *
+ * The default delta is the best choice for almost all the applications.<br/>
+ * Users should have a really good reason to choose something different.
+ */
+using DefaultDelta = Delta<DefaultRegistry::entity_type>;
+
+
+}
+
+
+#endif // ENTT_ENTITY_DELTA_HPP
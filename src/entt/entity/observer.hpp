@@ -0,0 +1,273 @@
+#ifndef ENTT_ENTITY_OBSERVER_HPP
+#define ENTT_ENTITY_OBSERVER_HPP
+
+
+#include <vector>
+#include <algorithm>
+#include "../config/config.h"
+#include "registry.hpp"
+#include "sparse_set.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Observer of changes to components.
+ *
+ * An observer records the entities whose components have been constructed or
+ * updated since the last time it was cleared. Entities are recorded once, no
+ * matter how many times their components change, and they are kept in a packed
+ * array. Therefore iterating the entities that changed is linear in the number
+ * of changes and not in the number of components in the pools.
+ *
+ * An entity is dropped from the observer when one of the observed components
+ * is removed from it, so that an observer never returns entities that are no
+ * longer valid. Use a destruction sink to be notified of removals.
+ *
+ * @note
+ * Observers are connected to the signals of the registry and must be cleared
+ * explicitly, as an example once per tick after changes have been consumed.
+ *
+ * @warning
+ * Lifetime of an observer mustn't overcome the one of the registry it's
+ * connected to. In any other case, the observer results in undefined behavior
+ * when it's destroyed.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class Observer final {
+    using view_type = SparseSet<Entity>;
+    using disconnect_fn_type = void(Registry<Entity> &, Observer *);
+
+    template<typename Component>
+    static void disconnecting(Registry<Entity> &registry, Observer *observer) {
+        registry.template construction<Component>().disconnect(observer);
+        registry.template update<Component>().disconnect(observer);
+        registry.template destruction<Component>().disconnect(observer);
+    }
+
+    void changing(Registry<Entity> &, const Entity entity) {
+        if(!changed.has(entity)) {
+            changed.construct(entity);
+        }
+    }
+
+    void discarding(Registry<Entity> &, const Entity entity) {
+        if(changed.has(entity)) {
+            changed.destroy(entity);
+        }
+    }
+
+public:
+    /*! @brief Type of registry to which an observer is connected. */
+    using registry_type = Registry<Entity>;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename view_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = typename view_type::size_type;
+    /*! @brief Input iterator type. */
+    using iterator_type = typename view_type::iterator_type;
+    /*! @brief Constant input iterator type. */
+    using const_iterator_type = typename view_type::const_iterator_type;
+
+    /**
+     * @brief Constructs an observer for the given registry.
+     *
+     * The observer gets its memory from the resource of the registry and it
+     * doesn't observe any component until `connect` is invoked.
+     *
+     * @param registry A valid registry.
+     */
+    explicit Observer(registry_type &registry)
+        : changed{registry.resource()},
+          registry{registry}
+    {}
+
+    /*! @brief Disconnects the observer from the registry. */
+    ~Observer() {
+        disconnect();
+    }
+
+    /*! @brief Copying an observer isn't allowed. */
+    Observer(const Observer &) = delete;
+    /*! @brief Moving an observer isn't allowed. */
+    Observer(Observer &&) = delete;
+
+    /*! @brief Copying an observer isn't allowed. @return This observer. */
+    Observer & operator=(const Observer &) = delete;
+    /*! @brief Moving an observer isn't allowed. @return This observer. */
+    Observer & operator=(Observer &&) = delete;
+
+    /**
+     * @brief Starts observing the given components.
+     *
+     * Entities are recorded whenever one of the given components is assigned
+     * to them, replaced or updated in any other way that notifies the update
+     * sink of the registry.
+     *
+     * @tparam Component Types of components to observe.
+     */
+    template<typename... Component>
+    void connect() {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (registry.template construction<Component>().template connect<Observer, &Observer::changing>(this), 0)... };
+        accumulator_type updates = { 0, (registry.template update<Component>().template connect<Observer, &Observer::changing>(this), 0)... };
+        accumulator_type destructions = { 0, (registry.template destruction<Component>().template connect<Observer, &Observer::discarding>(this), 0)... };
+        accumulator_type disconnections = { 0, (disconnects.push_back(&disconnecting<Component>), 0)... };
+        (void)accumulator;
+        (void)updates;
+        (void)destructions;
+        (void)disconnections;
+    }
+
+    /**
+     * @brief Stops observing all the components.
+     *
+     * Entities already recorded are kept until the observer is cleared.
+     */
+    void disconnect() {
+        for(auto *func: disconnects) {
+            func(registry, this);
+        }
+
+        disconnects.clear();
+    }
+
+    /**
+     * @brief Returns the number of entities that changed.
+     * @return Number of entities that changed.
+     */
+    size_type size() const ENTT_NOEXCEPT {
+        return changed.size();
+    }
+
+    /**
+     * @brief Checks whether no entity changed.
+     * @return True if no entity changed, false otherwise.
+     */
+    bool empty() const ENTT_NOEXCEPT {
+        return changed.empty();
+    }
+
+    /**
+     * @brief Direct access to the list of entities that changed.
+     *
+     * The returned pointer is such that range `[data(), data() + size()]` is
+     * always a valid range, even if the observer is empty.
+     *
+     * @return A pointer to the array of entities that changed.
+     */
+    const entity_type * data() const ENTT_NOEXCEPT {
+        return changed.data();
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity that changed.
+     *
+     * The returned iterator points to the first entity that changed. If the
+     * observer is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first entity that changed.
+     */
+    const_iterator_type cbegin() const ENTT_NOEXCEPT {
+        return changed.cbegin();
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity that changed.
+     *
+     * The returned iterator points to the first entity that changed. If the
+     * observer is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first entity that changed.
+     */
+    inline const_iterator_type begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity that changed.
+     *
+     * The returned iterator points to the element following the last entity
+     * that changed. Attempting to dereference the returned iterator results in
+     * undefined behavior.
+     *
+     * @return An iterator to the element following the last entity that
+     * changed.
+     */
+    const_iterator_type cend() const ENTT_NOEXCEPT {
+        return changed.cend();
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity that changed.
+     *
+     * The returned iterator points to the element following the last entity
+     * that changed. Attempting to dereference the returned iterator results in
+     * undefined behavior.
+     *
+     * @return An iterator to the element following the last entity that
+     * changed.
+     */
+    inline const_iterator_type end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    /**
+     * @brief Checks if an entity changed.
+     * @param entity A valid entity identifier.
+     * @return True if the entity changed, false otherwise.
+     */
+    bool contains(const entity_type entity) const ENTT_NOEXCEPT {
+        return changed.has(entity) && (changed.data()[changed.get(entity)] == entity);
+    }
+
+    /**
+     * @brief Iterates the entities that changed and applies the given function
+     * object to them.
+     *
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        std::for_each(changed.cbegin(), changed.cend(), std::move(func));
+    }
+
+    /**
+     * @brief Forgets all the entities that changed.
+     *
+     * The observer keeps observing the same components.
+     */
+    void clear() {
+        changed.reset();
+    }
+
+private:
+    std::vector<disconnect_fn_type *> disconnects;
+    view_type changed;
+    registry_type &registry;
+};
+
+
+/**
+ * @brief Default observer.
+ *
+ * The default observer is the best choice for almost all the applications.<br/>
+ * Users should have a really good reason to choose something different.
+ */
+using DefaultObserver = Observer<DefaultRegistry::entity_type>;
+
+
+}
+
+
+#endif // ENTT_ENTITY_OBSERVER_HPP
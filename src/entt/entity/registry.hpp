@@ -5,15 +5,19 @@
 #include <tuple>
 #include <vector>
 #include <memory>
+#include <iterator>
 #include <utility>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <cassert>
+#include <numeric>
 #include <algorithm>
 #include <type_traits>
 #include "../config/config.h"
 #include "../core/algorithm.hpp"
 #include "../core/family.hpp"
+#include "../core/memory.hpp"
 #include "../signal/sigh.hpp"
 #include "entt_traits.hpp"
 #include "snapshot.hpp"
@@ -40,22 +44,63 @@ class Registry {
     using tag_family = Family<struct InternalRegistryTagFamily>;
     using component_family = Family<struct InternalRegistryComponentFamily>;
     using handler_family = Family<struct InternalRegistryHandlerFamily>;
+    using group_family = Family<struct InternalRegistryGroupFamily>;
     using signal_type = SigH<void(Registry &, const Entity)>;
     using traits_type = entt_traits<Entity>;
+    using view_type = SparseSet<Entity>;
+    using mask_type = std::uint64_t;
 
-    template<typename... Component>
+    static constexpr auto mask_bits = std::numeric_limits<mask_type>::digits;
+
+    template<typename Exclude, typename... Component>
     static void creating(Registry &registry, const Entity entity) {
-        if(registry.has<Component...>(entity)) {
-            registry.handlers[handler_family::type<Component...>()]->construct(entity);
+        if(registry.has<Component...>(entity) && !registry.excluded(entity, Exclude{})) {
+            registry.handlers[handler_family::type<Exclude, Component...>()]->construct(entity);
         }
     }
 
-    template<typename... Component>
+    template<typename Exclude, typename... Component>
     static void destroying(Registry &registry, const Entity entity) {
-        auto &handler = *registry.handlers[handler_family::type<Component...>()];
+        auto &handler = *registry.handlers[handler_family::type<Exclude, Component...>()];
         return handler.has(entity) ? handler.destroy(entity) : void();
     }
 
+    template<typename Exclude, typename... Component>
+    static void releasing(Registry &registry, const Entity entity) {
+        // the excluded component is still assigned to the entity when the signal is emitted
+        if(registry.has<Component...>(entity) && registry.excluded(entity, Exclude{}) == 1) {
+            registry.handlers[handler_family::type<Exclude, Component...>()]->construct(entity);
+        }
+    }
+
+    template<typename... Component>
+    static void grouping(Registry &registry, const Entity entity) {
+        using first_type = std::tuple_element_t<0, std::tuple<Component...>>;
+        auto &length = *registry.groups[group_family::type<Component...>()];
+
+        if(registry.has<Component...>(entity) && !(registry.pool<first_type>().view_type::get(entity) < length)) {
+            const auto pos = length++;
+            using accumulator_type = int[];
+            accumulator_type accumulator = { (registry.pool<Component>().swap(registry.pool<Component>().view_type::get(entity), pos), 0)... };
+            (void)accumulator;
+        }
+    }
+
+    template<typename... Component>
+    static void ungrouping(Registry &registry, const Entity entity) {
+        using first_type = std::tuple_element_t<0, std::tuple<Component...>>;
+        auto &length = *registry.groups[group_family::type<Component...>()];
+        const auto &cpool = registry.pool<first_type>();
+
+        // entities within the group own all the components, checking the first pool is enough
+        if(cpool.has(entity) && cpool.view_type::get(entity) < length) {
+            const auto pos = --length;
+            using accumulator_type = int[];
+            accumulator_type accumulator = { (registry.pool<Component>().swap(registry.pool<Component>().view_type::get(entity), pos), 0)... };
+            (void)accumulator;
+        }
+    }
+
     struct Attachee {
         Attachee(const Entity entity): entity{entity} {}
         virtual ~Attachee() = default;
@@ -73,6 +118,11 @@ class Registry {
         Tag tag;
     };
 
+    using handler_type = ResourcePtr<SparseSet<Entity>>;
+    using group_type = ResourcePtr<std::size_t>;
+    using pool_type = std::tuple<ResourcePtr<SparseSet<Entity>>, signal_type, signal_type, signal_type>;
+    using tag_data_type = std::tuple<ResourcePtr<Attachee>, signal_type, signal_type>;
+
     template<typename Component>
     bool managed() const ENTT_NOEXCEPT {
         const auto ctype = component_family::type<Component>();
@@ -96,13 +146,15 @@ class Registry {
         const auto ctype = component_family::type<Component>();
 
         if(!(ctype < pools.size())) {
+            assert(!locked);
             pools.resize(ctype + 1);
         }
 
         auto &cpool = std::get<0>(pools[ctype]);
 
         if(!cpool) {
-            cpool = std::make_unique<SparseSet<Entity, Component>>();
+            assert(!locked);
+            cpool = allocate_unique<SparseSet<Entity, Component>>(resource(), resource());
         }
     }
 
@@ -111,10 +163,71 @@ class Registry {
         const auto ttype = tag_family::type<Tag>();
 
         if(!(ttype < tags.size())) {
+            assert(!locked);
             tags.resize(ttype + 1);
         }
     }
 
+    void restride(const std::size_t count) {
+        decltype(masks) other(entities.size() * count, mask_type{}, masks.get_allocator());
+
+        for(std::size_t pos{}, last = masks.size() / words; pos < last; ++pos) {
+            std::copy_n(masks.cbegin() + pos * words, words, other.begin() + pos * count);
+        }
+
+        masks = std::move(other);
+        words = count;
+    }
+
+    void mark(const Entity entity, const std::size_t ctype) {
+        if(words) {
+            if(!(ctype < words * mask_bits)) {
+                restride(ctype / mask_bits + 1);
+            }
+
+            const auto pos = std::size_t(entity & traits_type::entity_mask) * words;
+
+            if(!(pos < masks.size())) {
+                masks.resize(entities.size() * words);
+            }
+
+            masks[pos + ctype / mask_bits] |= mask_type{1} << (ctype % mask_bits);
+        }
+    }
+
+    void unmark(const Entity entity, const std::size_t ctype) {
+        const auto pos = std::size_t(entity & traits_type::entity_mask) * words + ctype / mask_bits;
+
+        if(ctype < words * mask_bits && pos < masks.size()) {
+            masks[pos] &= ~(mask_type{1} << (ctype % mask_bits));
+        }
+    }
+
+    template<typename... Exclude>
+    std::size_t excluded(const Entity entity, exclude_t<Exclude...>) const ENTT_NOEXCEPT {
+        std::size_t count{};
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (count += has<Exclude>(entity), 0)... };
+        (void)accumulator;
+        (void)entity;
+        return count;
+    }
+
+    bool owns(const std::size_t ctype) const ENTT_NOEXCEPT {
+        return ctype < owned.size() && owned[ctype];
+    }
+
+    mask_type signature(const Entity entity, const std::size_t word) const ENTT_NOEXCEPT {
+        // entities that never got a component may not have a mask yet
+        const auto pos = std::size_t(entity & traits_type::entity_mask) * words + word;
+        return pos < masks.size() ? masks[pos] : mask_type{};
+    }
+
+    bool marked(const Entity entity, const std::size_t ctype) const ENTT_NOEXCEPT {
+        const auto pos = std::size_t(entity & traits_type::entity_mask) * words + ctype / mask_bits;
+        return ctype < words * mask_bits && pos < masks.size() && ((masks[pos] >> (ctype % mask_bits)) & 1);
+    }
+
 public:
     /*! @brief Underlying entity identifier. */
     using entity_type = typename traits_type::entity_type;
@@ -130,7 +243,28 @@ public:
     using sink_type = typename signal_type::sink_type;
 
     /*! @brief Default constructor. */
-    Registry() = default;
+    Registry()
+        : Registry{default_resource()}
+    {}
+
+    /**
+     * @brief Constructs a registry that gets its memory from a resource.
+     *
+     * Pools, tags and all the internal data structures of the registry are
+     * allocated from the given resource. Listeners attached to signals are the
+     * only exception.
+     *
+     * @param resource A valid memory resource.
+     */
+    explicit Registry(MemoryResource *resource)
+        : handlers{Allocator<handler_type>{resource}},
+          groups{Allocator<group_type>{resource}},
+          owned{Allocator<bool>{resource}},
+          pools{Allocator<pool_type>{resource}},
+          tags{Allocator<tag_data_type>{resource}},
+          entities{Allocator<entity_type>{resource}},
+          masks{Allocator<mask_type>{resource}}
+    {}
 
     /*! @brief Copying a registry isn't allowed. */
     Registry(const Registry &) = delete;
@@ -142,6 +276,14 @@ public:
     /*! @brief Default move assignment operator. @return This registry. */
     Registry & operator=(Registry &&) = default;
 
+    /**
+     * @brief Returns the memory resource used by a registry.
+     * @return A pointer to the memory resource.
+     */
+    MemoryResource * resource() const ENTT_NOEXCEPT {
+        return entities.get_allocator().resource();
+    }
+
     /**
      * @brief Returns the numeric identifier of a type of tag at runtime.
      *
@@ -205,6 +347,8 @@ public:
      */
     template<typename Component>
     void reserve(const size_type cap) {
+        assert(!locked);
+
         assure<Component>();
         pool<Component>().reserve(cap);
     }
@@ -218,9 +362,115 @@ public:
      * @param cap Desired capacity.
      */
     void reserve(const size_type cap) {
+        assert(!locked);
+
         entities.reserve(cap);
     }
 
+    /**
+     * @brief Enables or disables per-entity signatures.
+     *
+     * A signature is a bitset that tells which components an entity owns, one
+     * bit for each type of component. When signatures are enabled, destroying
+     * entities, looking for orphans and checking whether an entity has more
+     * components no longer visit all the pools of the registry. On the other
+     * side, assigning and removing components is slightly slower and more
+     * memory is used.<br/>
+     * Signatures are disabled by default. They can be enabled at any time and
+     * they are built out of the pools that already exist, if any. The setting
+     * is kept when the registry is reset or restored from a snapshot.
+     *
+     * @note
+     * Tags aren't part of signatures. The registry still visits all of them
+     * when it looks for orphans or destroys an entity.
+     *
+     * @param enable True to enable signatures, false otherwise.
+     */
+    void signatures(const bool enable) {
+        assert(!locked);
+
+        if(!enable) {
+            masks.clear();
+            masks.shrink_to_fit();
+            words = {};
+        } else if(!words) {
+            words = pools.size() / mask_bits + 1;
+            masks.assign(entities.size() * words, mask_type{});
+
+            for(std::size_t ctype{}; ctype < pools.size(); ++ctype) {
+                if(std::get<0>(pools[ctype])) {
+                    for(const auto entity: *std::get<0>(pools[ctype])) {
+                        mark(entity, ctype);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Checks whether per-entity signatures are enabled.
+     * @return True if signatures are enabled, false otherwise.
+     */
+    bool signatures() const ENTT_NOEXCEPT {
+        return words != 0;
+    }
+
+    /**
+     * @brief Freezes the structure of a registry.
+     *
+     * The pools for the given components are created if they don't exist yet,
+     * then the registry is frozen until `thaw` is invoked. While a registry is
+     * frozen, its structure cannot change. Entities cannot be created nor
+     * destroyed, components and tags cannot be assigned nor removed, pools
+     * cannot be sorted or reset and the data structures of persistent views and
+     * groups that don't exist yet cannot be created.<br/>
+     * In exchange, creating views of any type for the given components, for
+     * the persistent views and the groups prepared in advance, getting
+     * components and all the const member functions don't modify the registry
+     * and can be invoked concurrently from different threads without data
+     * races. Components can also be updated in place, as long as different
+     * threads don't update the same instances.
+     *
+     * @warning
+     * Attempting to change the structure of a frozen registry results in
+     * undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * structure of a frozen registry is changed or if a pool is created for a
+     * component that wasn't given when the registry was frozen.
+     *
+     * @note
+     * Replacing or patching components notifies the listeners connected to the
+     * update sinks. Listeners must be thread-safe in turn if components are
+     * updated this way from different threads.
+     *
+     * @tparam Component Types of components for which to create the pools.
+     */
+    template<typename... Component>
+    void freeze() {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (assure<Component>(), 0)... };
+        (void)accumulator;
+        locked = true;
+    }
+
+    /**
+     * @brief Thaws a registry previously frozen.
+     *
+     * Once thawed, the structure of a registry can change again. This function
+     * mustn't be invoked while other threads are still using the registry.
+     */
+    void thaw() ENTT_NOEXCEPT {
+        locked = false;
+    }
+
+    /**
+     * @brief Checks whether the structure of a registry is frozen.
+     * @return True if the registry is frozen, false otherwise.
+     */
+    bool frozen() const ENTT_NOEXCEPT {
+        return locked;
+    }
+
     /**
      * @brief Returns the number of entities ever created.
      * @return Number of entities ever created.
@@ -259,11 +509,17 @@ public:
      * There are no guarantees on the order of the components. Use a view if you
      * want to iterate entities and components in the expected order.
      *
+     * @warning
+     * Components of empty types aren't stored and the range isn't valid in this
+     * case (see SparseSet for more details).<br/>
+     * Components laid out as structure of arrays are returned through a proxy
+     * pointer (see soa_traits for more details).
+     *
      * @tparam Component Type of component in which one is interested.
      * @return A pointer to the array of components of the given type.
      */
     template<typename Component>
-    const Component * raw() const ENTT_NOEXCEPT {
+    typename SparseSet<Entity, Component>::const_pointer_type raw() const ENTT_NOEXCEPT {
         return managed<Component>() ? pool<Component>().raw() : nullptr;
     }
 
@@ -278,12 +534,18 @@ public:
      * There are no guarantees on the order of the components. Use a view if you
      * want to iterate entities and components in the expected order.
      *
+     * @warning
+     * Components of empty types aren't stored and the range isn't valid in this
+     * case (see SparseSet for more details).<br/>
+     * Components laid out as structure of arrays are returned through a proxy
+     * pointer (see soa_traits for more details).
+     *
      * @tparam Component Type of component in which one is interested.
      * @return A pointer to the array of components of the given type.
      */
     template<typename Component>
-    inline Component * raw() ENTT_NOEXCEPT {
-        return const_cast<Component *>(const_cast<const Registry *>(this)->raw<Component>());
+    typename SparseSet<Entity, Component>::pointer_type raw() ENTT_NOEXCEPT {
+        return managed<Component>() ? pool<Component>().raw() : nullptr;
     }
 
     /**
@@ -388,6 +650,8 @@ public:
      * @return A valid entity identifier.
      */
     entity_type create() ENTT_NOEXCEPT {
+        assert(!locked);
+
         entity_type entity;
 
         if(available) {
@@ -408,6 +672,43 @@ public:
         return entity;
     }
 
+    /**
+     * @brief Creates many entities at once and assigns them to a range.
+     *
+     * Recycled entity identifiers are consumed first, if any. Then the
+     * registry grows its internal storage once for all the remaining entities
+     * and creates them from scratch.
+     *
+     * @sa create
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range to populate.
+     * @param last An iterator past the last element of the range to populate.
+     */
+    template<typename It>
+    void create(It first, It last) {
+        assert(!locked);
+
+        for(; available && first != last; ++first) {
+            const auto entt = next;
+            const auto version = entities[entt] & (~traits_type::entity_mask);
+
+            const auto entity = entt | version;
+
+            next = entities[entt] & traits_type::entity_mask;
+            entities[entt] = entity;
+            *first = entity;
+            --available;
+        }
+
+        const auto sz = entities.size();
+        entities.resize(sz + std::distance(first, last));
+        // traits_type::entity_mask is reserved to allow for null identifiers
+        assert(entities.size() <= traits_type::entity_mask);
+        std::iota(entities.begin() + sz, entities.end(), entity_type(sz));
+        std::copy(entities.cbegin() + sz, entities.cend(), first);
+    }
+
     /**
      * @brief Destroys an entity and lets the registry recycle the identifier.
      *
@@ -431,17 +732,34 @@ public:
      * @param entity A valid entity identifier
      */
     void destroy(const entity_type entity) {
+        assert(!locked);
         assert(valid(entity));
 
-        for(auto pos = pools.size(); pos; --pos) {
-            auto &tup = pools[pos-1];
-            auto &cpool = std::get<0>(tup);
-
-            if(cpool && cpool->has(entity)) {
-                std::get<2>(tup).publish(*this, entity);
-                cpool->destroy(entity);
+        if(words) {
+            // listeners can remove components, masks must be reloaded each time
+            for(std::size_t word{}; word < words; ++word) {
+                for(std::size_t bit{}; bit < mask_bits && (signature(entity, word) >> bit); ++bit) {
+                    const auto ctype = word * mask_bits + bit;
+
+                    if(marked(entity, ctype)) {
+                        auto &tup = pools[ctype];
+                        std::get<2>(tup).publish(*this, entity);
+                        std::get<0>(tup)->destroy(entity);
+                        unmark(entity, ctype);
+                    }
+                }
             }
-        };
+        } else {
+            for(auto pos = pools.size(); pos; --pos) {
+                auto &tup = pools[pos-1];
+                auto &cpool = std::get<0>(tup);
+
+                if(cpool && cpool->has(entity)) {
+                    std::get<2>(tup).publish(*this, entity);
+                    cpool->destroy(entity);
+                }
+            };
+        }
 
         for(auto pos = tags.size(); pos; --pos) {
             auto &tup = tags[pos-1];
@@ -488,11 +806,12 @@ public:
      */
     template<typename Tag, typename... Args>
     Tag & assign(tag_t, const entity_type entity, Args &&... args) {
+        assert(!locked);
         assert(valid(entity));
         assert(!has<Tag>());
         assure<Tag>(tag_t{});
         auto &tup = tags[tag_family::type<Tag>()];
-        std::get<0>(tup).reset(new Attaching<Tag>{entity, std::forward<Args>(args)...});
+        std::get<0>(tup) = allocate_unique<Attaching<Tag>>(resource(), entity, std::forward<Args>(args)...);
         std::get<1>(tup).publish(*this, entity);
         return get<Tag>();
     }
@@ -518,20 +837,125 @@ public:
      * @return A reference to the newly created component.
      */
     template<typename Component, typename... Args>
-    Component & assign(const entity_type entity, Args &&... args) {
+    typename SparseSet<Entity, Component>::reference_type assign(const entity_type entity, Args &&... args) {
+        assert(!locked);
         assert(valid(entity));
         assure<Component>();
+        const auto ctype = component_family::type<Component>();
         pool<Component>().construct(entity, std::forward<Args>(args)...);
-        std::get<1>(pools[component_family::type<Component>()]).publish(*this, entity);
+        mark(entity, ctype);
+        std::get<1>(pools[ctype]).publish(*this, entity);
         return pool<Component>().get(entity);
     }
 
+    /**
+     * @brief Assigns the given component to a range of entities.
+     *
+     * A new instance of the given component is copy-constructed from the value
+     * provided for each entity in the range. Storage is reserved once and the
+     * components are laid out contiguously, then listeners are notified for
+     * all the entities in a single pass.
+     *
+     * @note
+     * _Sfinae'd_ function.<br/>
+     * This version is used for iterators that aren't convertible to entity
+     * identifiers, so as not to clash with the overload for single entities.
+     *
+     * @note
+     * Owning groups move the entities that join them to the beginning of the
+     * pools they own. Once listeners are notified, the components created are
+     * scattered across the pool and a null pointer is returned. Use `get` to
+     * access them in this case.
+     *
+     * @warning
+     * Attempting to use an invalid entity or to assign a component to an entity
+     * that already owns it results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case of
+     * invalid entity or if an entity already owns an instance of the given
+     * component.
+     *
+     * @tparam Component Type of component to create.
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value An instance of the component to copy for each entity.
+     * @return A pointer to the array of components created for the entities,
+     * a null pointer if the pool is owned by a group.
+     */
+    template<typename Component, typename It>
+    std::enable_if_t<!std::is_convertible<It, entity_type>::value, typename SparseSet<Entity, Component>::pointer_type>
+    assign(It first, It last, const Component &value = {}) {
+        assert(!locked);
+        assert(std::all_of(first, last, [this](const auto entity) { return valid(entity); }));
+        assure<Component>();
+        const auto ctype = component_family::type<Component>();
+        auto component = pool<Component>().construct(first, last, value);
+        auto &sig = std::get<1>(pools[ctype]);
+        std::for_each(first, last, [ctype, this](const auto entity) { mark(entity, ctype); });
+        std::for_each(first, last, [&sig, this](const auto entity) { sig.publish(*this, entity); });
+        // owning groups rearrange their pools, the components created are no longer contiguous
+        return owns(ctype) ? nullptr : component;
+    }
+
+    /**
+     * @brief Assigns the given component to a range of entities, copying the
+     * instances from an array.
+     *
+     * The instance at position `i` in the array is given to the `i`-th entity
+     * of the range. Storage is reserved once and the components are laid out
+     * contiguously, then listeners are notified for all the entities in a
+     * single pass, when the components are already in place.
+     *
+     * @note
+     * _Sfinae'd_ function.<br/>
+     * This version is used for iterators that aren't convertible to entity
+     * identifiers, so as not to clash with the overload for single entities.
+     *
+     * @note
+     * Owning groups move the entities that join them to the beginning of the
+     * pools they own. Once listeners are notified, the components created are
+     * scattered across the pool and a null pointer is returned. Use `get` to
+     * access them in this case.
+     *
+     * @warning
+     * Attempting to use an invalid entity or to assign a component to an entity
+     * that already owns it results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case of
+     * invalid entity or if an entity already owns an instance of the given
+     * component.
+     *
+     * @tparam Component Type of component to create.
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param instances A pointer to an array of components at least as long as
+     * the range of entities.
+     * @return A pointer to the array of components created for the entities,
+     * a null pointer if the pool is owned by a group.
+     */
+    template<typename Component, typename It>
+    std::enable_if_t<!std::is_convertible<It, entity_type>::value, typename SparseSet<Entity, Component>::pointer_type>
+    assign(It first, It last, const Component *instances) {
+        assert(!locked);
+        assert(std::all_of(first, last, [this](const auto entity) { return valid(entity); }));
+        assure<Component>();
+        const auto ctype = component_family::type<Component>();
+        auto component = pool<Component>().construct(first, last, instances);
+        auto &sig = std::get<1>(pools[ctype]);
+        std::for_each(first, last, [ctype, this](const auto entity) { mark(entity, ctype); });
+        std::for_each(first, last, [&sig, this](const auto entity) { sig.publish(*this, entity); });
+        // owning groups rearrange their pools, the components created are no longer contiguous
+        return owns(ctype) ? nullptr : component;
+    }
+
     /**
      * @brief Removes the given tag from its owner, if any.
      * @tparam Tag Type of tag to remove.
      */
     template<typename Tag>
     void remove() {
+        assert(!locked);
+
         if(has<Tag>()) {
             auto &tup = tags[tag_family::type<Tag>()];
             auto &tag = std::get<0>(tup);
@@ -555,11 +979,51 @@ public:
      */
     template<typename Component>
     void remove(const entity_type entity) {
+        assert(!locked);
         assert(valid(entity));
         assert(managed<Component>());
         const auto ctype = component_family::type<Component>();
         std::get<2>(pools[ctype]).publish(*this, entity);
         pool<Component>().destroy(entity);
+        unmark(entity, ctype);
+    }
+
+    /**
+     * @brief Removes the given component from a range of entities.
+     *
+     * @note
+     * _Sfinae'd_ function.<br/>
+     * This version is used for iterators that aren't convertible to entity
+     * identifiers, so as not to clash with the overload for single entities.
+     *
+     * @warning
+     * Attempting to use an invalid entity or to remove a component from an
+     * entity that doesn't own it results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case of
+     * invalid entity or if an entity doesn't own an instance of the given
+     * component.
+     *
+     * @tparam Component Type of component to remove.
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename Component, typename It>
+    std::enable_if_t<!std::is_convertible<It, entity_type>::value>
+    remove(It first, It last) {
+        assert(!locked);
+        assert(managed<Component>());
+        const auto ctype = component_family::type<Component>();
+        auto &sig = std::get<2>(pools[ctype]);
+        auto &cpool = pool<Component>();
+
+        for(; first != last; ++first) {
+            const auto entity = *first;
+            assert(valid(entity));
+            sig.publish(*this, entity);
+            cpool.destroy(entity);
+            unmark(entity, ctype);
+        }
     }
 
     /**
@@ -616,8 +1080,15 @@ public:
         assert(valid(entity));
         bool all = true;
         using accumulator_type = bool[];
-        accumulator_type accumulator = { all, (all = all && managed<Component>() && pool<Component>().has(entity))... };
-        (void)accumulator;
+
+        if(words) {
+            accumulator_type accumulator = { all, (all = all && marked(entity, component_family::type<Component>()))... };
+            (void)accumulator;
+        } else {
+            accumulator_type accumulator = { all, (all = all && managed<Component>() && pool<Component>().has(entity))... };
+            (void)accumulator;
+        }
+
         return all;
     }
 
@@ -671,7 +1142,7 @@ public:
      * @return A reference to the component owned by the entity.
      */
     template<typename Component>
-    const Component & get(const entity_type entity) const ENTT_NOEXCEPT {
+    typename SparseSet<Entity, Component>::const_reference_type get(const entity_type entity) const ENTT_NOEXCEPT {
         assert(valid(entity));
         assert(managed<Component>());
         return pool<Component>().get(entity);
@@ -692,8 +1163,10 @@ public:
      * @return A reference to the component owned by the entity.
      */
     template<typename Component>
-    inline Component & get(const entity_type entity) ENTT_NOEXCEPT {
-        return const_cast<Component &>(const_cast<const Registry *>(this)->get<Component>(entity));
+    typename SparseSet<Entity, Component>::reference_type get(const entity_type entity) ENTT_NOEXCEPT {
+        assert(valid(entity));
+        assert(managed<Component>());
+        return pool<Component>().get(entity);
     }
 
     /**
@@ -711,9 +1184,9 @@ public:
      * @return References to the components owned by the entity.
      */
     template<typename... Component>
-    inline std::enable_if_t<(sizeof...(Component) > 1), std::tuple<const Component &...>>
+    inline std::enable_if_t<(sizeof...(Component) > 1), std::tuple<typename SparseSet<Entity, Component>::const_reference_type...>>
     get(const entity_type entity) const ENTT_NOEXCEPT {
-        return std::tuple<const Component &...>{get<Component>(entity)...};
+        return std::tuple<typename SparseSet<Entity, Component>::const_reference_type...>{get<Component>(entity)...};
     }
 
     /**
@@ -731,9 +1204,9 @@ public:
      * @return References to the components owned by the entity.
      */
     template<typename... Component>
-    inline std::enable_if_t<(sizeof...(Component) > 1), std::tuple<Component &...>>
+    inline std::enable_if_t<(sizeof...(Component) > 1), std::tuple<typename SparseSet<Entity, Component>::reference_type...>>
     get(const entity_type entity) ENTT_NOEXCEPT {
-        return std::tuple<Component &...>{get<Component>(entity)...};
+        return std::tuple<typename SparseSet<Entity, Component>::reference_type...>{get<Component>(entity)...};
     }
 
     /**
@@ -764,7 +1237,8 @@ public:
      *
      * A new instance of the given component is created and initialized with the
      * arguments provided (the component must have a proper constructor or be of
-     * aggregate type). Then the component is assigned to the given entity.
+     * aggregate type). Then the component is assigned to the given entity and
+     * the listeners connected to the update sink are notified.
      *
      * @warning
      * Attempting to use an invalid entity or to replace a component of an
@@ -780,8 +1254,45 @@ public:
      * @return A reference to the newly created component.
      */
     template<typename Component, typename... Args>
-    Component & replace(const entity_type entity, Args &&... args) {
-        return (get<Component>(entity) = Component{std::forward<Args>(args)...});
+    typename SparseSet<Entity, Component>::reference_type replace(const entity_type entity, Args &&... args) {
+        get<Component>(entity) = Component{std::forward<Args>(args)...};
+        std::get<3>(pools[component_family::type<Component>()]).publish(*this, entity);
+        return get<Component>(entity);
+    }
+
+    /**
+     * @brief Patches the given component for an entity.
+     *
+     * The component is updated in place by the given function object, then
+     * the listeners connected to the update sink are notified. Unlike
+     * `replace`, no new instance of the component is created and therefore
+     * only the data members actually modified by the function object are
+     * written.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(Component &);
+     * @endcode
+     *
+     * @warning
+     * Attempting to use an invalid entity or to patch a component of an entity
+     * that doesn't own it results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case of
+     * invalid entity or if the entity doesn't own an instance of the given
+     * component.
+     *
+     * @tparam Component Type of component to patch.
+     * @tparam Func Type of the function object to invoke.
+     * @param entity A valid entity identifier.
+     * @param func A valid function object.
+     * @return A reference to the patched component.
+     */
+    template<typename Component, typename Func>
+    typename SparseSet<Entity, Component>::reference_type patch(const entity_type entity, Func func) {
+        decltype(auto) component = get<Component>(entity);
+        func(component);
+        std::get<3>(pools[component_family::type<Component>()]).publish(*this, entity);
+        return component;
     }
 
     /**
@@ -802,6 +1313,7 @@ public:
      */
     template<typename Tag>
     entity_type move(const entity_type entity) {
+        assert(!locked);
         assert(valid(entity));
         assert(has<Tag>());
         auto &tag = std::get<0>(tags[tag_family::type<Tag>()]);
@@ -855,13 +1367,15 @@ public:
      * @return A reference to the newly created component.
      */
     template<typename Component, typename... Args>
-    Component & accommodate(const entity_type entity, Args &&... args) {
+    typename SparseSet<Entity, Component>::reference_type accommodate(const entity_type entity, Args &&... args) {
         assure<Component>();
         auto &cpool = pool<Component>();
 
-        return (cpool.has(entity)
-                ? cpool.get(entity) = Component{std::forward<Args>(args)...}
-                : cpool.construct(entity, std::forward<Args>(args)...));
+        if(cpool.has(entity)) {
+            return replace<Component>(entity, std::forward<Args>(args)...);
+        }
+
+        return assign<Component>(entity, std::forward<Args>(args)...);
     }
 
     /**
@@ -922,6 +1436,36 @@ public:
         return std::get<1>(pools[component_family::type<Component>()]).sink();
     }
 
+    /**
+     * @brief Returns a sink object for the given component.
+     *
+     * A sink is an opaque object used to connect listeners to components.<br/>
+     * The sink returned by this function can be used to receive notifications
+     * whenever an instance of the given component is updated, that is when it's
+     * replaced either directly or by means of `accommodate` and when it's
+     * patched in place.
+     *
+     * The function type for a listener is:
+     * @code{.cpp}
+     * void(Registry<Entity> &, Entity);
+     * @endcode
+     *
+     * Listeners are invoked **after** the component has been updated. The order
+     * of invocation of the listeners isn't guaranteed.<br/>
+     * Note also that the greater the number of listeners, the greater the
+     * performance hit when a component is updated.
+     *
+     * @sa SigH::Sink
+     *
+     * @tparam Component Type of component of which to get the sink.
+     * @return A temporary sink object.
+     */
+    template<typename Component>
+    sink_type update() ENTT_NOEXCEPT {
+        assure<Component>();
+        return std::get<3>(pools[component_family::type<Component>()]).sink();
+    }
+
     /**
      * @brief Returns a sink object for the given tag.
      *
@@ -1013,6 +1557,21 @@ public:
      * necessarily the type of the one passed along with the other parameters to
      * this member function.
      *
+     * A unary function object that returns an unsigned integral key for the
+     * given component can be used in place of the comparison function, along
+     * with a sort function object that accepts a key getter (see RadixSort for
+     * more details):
+     *
+     * @code{.cpp}
+     * registry.sort<Sprite>([](const auto &sprite) { return sprite.depth; }, entt::RadixSort<8, 32>{});
+     * @endcode
+     *
+     * @warning
+     * Attempting to sort a pool owned by a group results in undefined
+     * behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * the pool is owned by a group.
+     *
      * @tparam Component Type of components to sort.
      * @tparam Compare Type of comparison function object.
      * @tparam Sort Type of sort function object.
@@ -1021,7 +1580,10 @@ public:
      */
     template<typename Component, typename Compare, typename Sort = StdSort>
     void sort(Compare compare, Sort sort = Sort{}) {
+        assert(!locked);
+
         assure<Component>();
+        assert(!owns(component_family::type<Component>()));
         pool<Component>().sort(std::move(compare), std::move(sort));
     }
 
@@ -1052,13 +1614,22 @@ public:
      *
      * Any subsequent change to `B` won't affect the order in `A`.
      *
+     * @warning
+     * Attempting to sort a pool owned by a group results in undefined
+     * behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * the pool is owned by a group.
+     *
      * @tparam To Type of components to sort.
      * @tparam From Type of components to use to sort.
      */
     template<typename To, typename From>
     void sort() {
+        assert(!locked);
+
         assure<To>();
         assure<From>();
+        assert(!owns(component_family::type<To>()));
         pool<To>().respect(pool<From>());
     }
 
@@ -1078,6 +1649,7 @@ public:
      */
     template<typename Component>
     void reset(const entity_type entity) {
+        assert(!locked);
         assert(valid(entity));
         assure<Component>();
         const auto ctype = component_family::type<Component>();
@@ -1086,6 +1658,7 @@ public:
         if(cpool.has(entity)) {
             std::get<2>(pools[ctype]).publish(*this, entity);
             cpool.destroy(entity);
+            unmark(entity, ctype);
         }
     }
 
@@ -1099,6 +1672,8 @@ public:
      */
     template<typename Component>
     void reset() {
+        assert(!locked);
+
         assure<Component>();
         const auto ctype = component_family::type<Component>();
         auto &cpool = *std::get<0>(pools[ctype]);
@@ -1107,6 +1682,7 @@ public:
         for(const auto entity: cpool) {
             sig.publish(*this, entity);
             cpool.destroy(entity);
+            unmark(entity, ctype);
         }
     }
 
@@ -1119,6 +1695,8 @@ public:
      * to know if they are still valid.
      */
     void reset() {
+        assert(!locked);
+
         each([this](const auto entity) {
             destroy(entity);
         });
@@ -1176,9 +1754,17 @@ public:
         assert(valid(entity));
         bool orphan = true;
 
-        for(std::size_t i = 0; i < pools.size() && orphan; ++i) {
-            const auto &pool = std::get<0>(pools[i]);
-            orphan = !(pool && pool->has(entity));
+        if(words) {
+            const auto pos = std::size_t(entity & traits_type::entity_mask) * words;
+
+            for(std::size_t i = 0; i < words && pos < masks.size() && orphan; ++i) {
+                orphan = !masks[pos + i];
+            }
+        } else {
+            for(std::size_t i = 0; i < pools.size() && orphan; ++i) {
+                const auto &pool = std::get<0>(pools[i]);
+                orphan = !(pool && pool->has(entity));
+            }
         }
 
         for(std::size_t i = 0; i < tags.size() && orphan; ++i) {
@@ -1252,6 +1838,34 @@ public:
         return View<Entity, Component...>{(assure<Component>(), pool<Component>())...};
     }
 
+    /**
+     * @brief Returns a standard view for the given components that filters out
+     * the entities that have at least one of the excluded components.
+     *
+     * This kind of views are created on the fly and share with the registry its
+     * internal data structures.<br/>
+     * Feel free to discard a view after the use. Creating and destroying a view
+     * is an incredibly cheap operation because they do not require any type of
+     * initialization.<br/>
+     * As a rule of thumb, storing a view should never be an option.
+     *
+     * Candidates are selected the same way a standard view does for the given
+     * components. Excluded components are only used to filter them and they
+     * aren't returned during iterations.
+     *
+     * @see View
+     * @see View<Entity, exclude_t<Exclude...>, Component...>
+     * @see PersistentView
+     *
+     * @tparam Component Type of components used to construct the view.
+     * @tparam Exclude Types of components used to filter the view.
+     * @return A newly created standard view.
+     */
+    template<typename... Component, typename... Exclude>
+    View<Entity, exclude_t<Exclude...>, Component...> view(exclude_t<Exclude...>) {
+        return View<Entity, exclude_t<Exclude...>, Component...>{view<Component...>(), pool<Component>()..., (assure<Exclude>(), pool<Exclude>())...};
+    }
+
     /**
      * @brief Prepares the internal data structures used by persistent views.
      *
@@ -1266,34 +1880,50 @@ public:
      * can be prepared with this function. Just use the same set of components
      * that would have been used otherwise to construct the view.
      *
+     * Persistent views can also exclude the entities that have at least one of
+     * a given set of components. The exclusion list is part of the identity of
+     * a persistent view, that is, views with different exclusion lists have
+     * different internal data structures.
+     *
      * @tparam Component Types of components used to prepare the view.
+     * @tparam Exclude Types of components used to filter the view.
      */
-    template<typename... Component>
-    void prepare() {
-        static_assert(sizeof...(Component) > 1, "!");
-        const auto htype = handler_family::type<Component...>();
+    template<typename... Component, typename... Exclude>
+    void prepare(exclude_t<Exclude...> = {}) {
+        static_assert(sizeof...(Component) + sizeof...(Exclude) > 1, "!");
+        using exclude_type = exclude_t<Exclude...>;
+        const auto htype = handler_family::type<exclude_type, Component...>();
 
         if(!(htype < handlers.size())) {
+            assert(!locked);
             handlers.resize(htype + 1);
         }
 
         if(!handlers[htype]) {
-            handlers[htype] = std::make_unique<SparseSet<entity_type>>();
+            assert(!locked);
+            handlers[htype] = allocate_unique<SparseSet<entity_type>>(resource(), resource());
             auto &handler = handlers[htype];
 
-            for(auto entity: view<Component...>()) {
+            for(auto entity: view<Component...>(exclude_type{})) {
                 handler->construct(entity);
             }
 
             auto connect = [this](const auto ctype) {
                 auto &cpool = pools[ctype];
-                std::get<1>(cpool).sink().template connect<&Registry::creating<Component...>>();
-                std::get<2>(cpool).sink().template connect<&Registry::destroying<Component...>>();
+                std::get<1>(cpool).sink().template connect<&Registry::creating<exclude_type, Component...>>();
+                std::get<2>(cpool).sink().template connect<&Registry::destroying<exclude_type, Component...>>();
+            };
+
+            auto filter = [this](const auto ctype) {
+                auto &cpool = pools[ctype];
+                std::get<1>(cpool).sink().template connect<&Registry::destroying<exclude_type, Component...>>();
+                std::get<2>(cpool).sink().template connect<&Registry::releasing<exclude_type, Component...>>();
             };
 
             using accumulator_type = int[];
-            accumulator_type accumulator = { (assure<Component>(), connect(component_family::type<Component>()), 0)... };
+            accumulator_type accumulator = { 0, (assure<Component>(), connect(component_family::type<Component>()), 0)..., (assure<Exclude>(), filter(component_family::type<Exclude>()), 0)... };
             (void)accumulator;
+            (void)filter;
         }
     }
 
@@ -1311,36 +1941,154 @@ public:
      * neither in debug mode nor in release mode.
      *
      * @tparam Component Types of components of the persistent view.
+     * @tparam Exclude Types of components used to filter the view.
      */
-    template<typename... Component>
-    void discard() {
-        if(contains<Component...>()) {
-            const auto htype = handler_family::type<Component...>();
+    template<typename... Component, typename... Exclude>
+    void discard(exclude_t<Exclude...> = {}) {
+        assert(!locked);
+
+        using exclude_type = exclude_t<Exclude...>;
+
+        if(contains<Component...>(exclude_type{})) {
+            const auto htype = handler_family::type<exclude_type, Component...>();
 
             auto disconnect = [this](const auto ctype) {
                 auto &cpool = pools[ctype];
-                std::get<1>(cpool).sink().template disconnect<&Registry::creating<Component...>>();
-                std::get<2>(cpool).sink().template disconnect<&Registry::destroying<Component...>>();
+                std::get<1>(cpool).sink().template disconnect<&Registry::creating<exclude_type, Component...>>();
+                std::get<2>(cpool).sink().template disconnect<&Registry::destroying<exclude_type, Component...>>();
+            };
+
+            auto unfilter = [this](const auto ctype) {
+                auto &cpool = pools[ctype];
+                std::get<1>(cpool).sink().template disconnect<&Registry::destroying<exclude_type, Component...>>();
+                std::get<2>(cpool).sink().template disconnect<&Registry::releasing<exclude_type, Component...>>();
             };
 
             // if a set exists, pools have already been created for it
             using accumulator_type = int[];
-            accumulator_type accumulator = { (disconnect(component_family::type<Component>()), 0)... };
+            accumulator_type accumulator = { 0, (disconnect(component_family::type<Component>()), 0)..., (unfilter(component_family::type<Exclude>()), 0)... };
             handlers[htype].reset();
             (void)accumulator;
+            (void)unfilter;
         }
     }
 
     /**
      * @brief Checks if a persistent view has already been prepared.
      * @tparam Component Types of components of the persistent view.
+     * @tparam Exclude Types of components used to filter the view.
      * @return True if the view has already been prepared, false otherwise.
      */
+    template<typename... Component, typename... Exclude>
+    bool contains(exclude_t<Exclude...> = {}) const ENTT_NOEXCEPT {
+        static_assert(sizeof...(Component) + sizeof...(Exclude) > 1, "!");
+        const auto htype = handler_family::type<exclude_t<Exclude...>, Component...>();
+        return (htype < handlers.size() && handlers[htype]);
+    }
+
+    /**
+     * @brief Prepares the internal data structures used by owning groups.
+     *
+     * Owning groups arrange the pools of the given components so that the
+     * entities that have all of them are packed at the beginning of each pool
+     * in the same order. These pools are said to be _owned_ by the group.<br/>
+     * Sorting an owned pool isn't allowed and a pool cannot be owned by more
+     * than one group at a time. Assigning a component to a range of entities
+     * returns a null pointer when its pool is owned, since the components
+     * created aren't contiguous once the entities joined the group.
+     *
+     * @warning
+     * Attempting to own a pool that is already owned by another group results
+     * in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * one of the pools is already owned.
+     *
+     * @see Group
+     *
+     * @tparam Component Types of components owned by the group.
+     */
     template<typename... Component>
-    bool contains() const ENTT_NOEXCEPT {
+    void prepare(group_t) {
         static_assert(sizeof...(Component) > 1, "!");
-        const auto htype = handler_family::type<Component...>();
-        return (htype < handlers.size() && handlers[htype]);
+        const auto gtype = group_family::type<Component...>();
+
+        if(!(gtype < groups.size())) {
+            assert(!locked);
+            groups.resize(gtype + 1);
+        }
+
+        if(!groups[gtype]) {
+            assert(!locked);
+
+            auto own = [this](const auto ctype) {
+                if(!(ctype < owned.size())) {
+                    owned.resize(ctype + 1);
+                }
+
+                assert(!owned[ctype]);
+                owned[ctype] = true;
+            };
+
+            using accumulator_type = int[];
+            accumulator_type owners = { (assure<Component>(), own(component_family::type<Component>()), 0)... };
+            (void)owners;
+
+            groups[gtype] = allocate_unique<size_type>(resource());
+            const auto candidates = view<Component...>();
+            const std::vector<entity_type> entities(candidates.begin(), candidates.end());
+
+            for(const auto entity: entities) {
+                grouping<Component...>(*this, entity);
+            }
+
+            auto connect = [this](const auto ctype) {
+                auto &cpool = pools[ctype];
+                std::get<1>(cpool).sink().template connect<&Registry::grouping<Component...>>();
+                std::get<2>(cpool).sink().template connect<&Registry::ungrouping<Component...>>();
+            };
+
+            accumulator_type accumulator = { (connect(component_family::type<Component>()), 0)... };
+            (void)accumulator;
+        }
+    }
+
+    /**
+     * @brief Discards all the data structures used for a given owning group.
+     *
+     * Pools are no longer owned and they can be sorted freely. The order of
+     * their elements isn't affected by this call.
+     *
+     * @tparam Component Types of components owned by the group.
+     */
+    template<typename... Component>
+    void discard(group_t) {
+        assert(!locked);
+
+        if(contains<Component...>(group_t{})) {
+            auto disconnect = [this](const auto ctype) {
+                auto &cpool = pools[ctype];
+                std::get<1>(cpool).sink().template disconnect<&Registry::grouping<Component...>>();
+                std::get<2>(cpool).sink().template disconnect<&Registry::ungrouping<Component...>>();
+                owned[ctype] = false;
+            };
+
+            using accumulator_type = int[];
+            accumulator_type accumulator = { (disconnect(component_family::type<Component>()), 0)... };
+            groups[group_family::type<Component...>()].reset();
+            (void)accumulator;
+        }
+    }
+
+    /**
+     * @brief Checks if an owning group has already been prepared.
+     * @tparam Component Types of components owned by the group.
+     * @return True if the group has already been prepared, false otherwise.
+     */
+    template<typename... Component>
+    bool contains(group_t) const ENTT_NOEXCEPT {
+        static_assert(sizeof...(Component) > 1, "!");
+        const auto gtype = group_family::type<Component...>();
+        return (gtype < groups.size() && groups[gtype]);
     }
 
     /**
@@ -1378,16 +2126,62 @@ public:
      * @see PersistentView
      * @see RawView
      *
+     * Entities that have at least one of the excluded components aren't part of
+     * the view. Excluded components aren't returned during iterations.
+     *
      * @tparam Component Types of components used to construct the view.
+     * @tparam Exclude Types of components used to filter the view.
      * @return A newly created persistent view.
      */
-    template<typename... Component>
-    PersistentView<Entity, Component...> view(persistent_t) {
-        prepare<Component...>();
-        const auto htype = handler_family::type<Component...>();
+    template<typename... Component, typename... Exclude>
+    PersistentView<Entity, Component...> view(persistent_t, exclude_t<Exclude...> = {}) {
+        prepare<Component...>(exclude_t<Exclude...>{});
+        const auto htype = handler_family::type<exclude_t<Exclude...>, Component...>();
         return PersistentView<Entity, Component...>{*handlers[htype], (assure<Component>(), pool<Component>())...};
     }
 
+    /**
+     * @brief Returns an owning group for the given components.
+     *
+     * This kind of objects are created on the fly and share with the registry
+     * its internal data structures.<br/>
+     * Feel free to discard a group after the use. Creating and destroying a
+     * group is an incredibly cheap operation because they do not require any
+     * type of initialization.<br/>
+     * As a rule of thumb, storing a group should never be an option.
+     *
+     * Owning groups are the fastest tool to iterate entities and components
+     * for multiple types. Entities and components are laid out in parallel
+     * arrays and no indirections are involved at all.<br/>
+     * However they have also drawbacks:
+     *
+     * * The pools of the given components are owned by the group. They cannot
+     *   be sorted and cannot be owned by any other group.
+     * * Pools must be kept arranged and it affects slightly construction and
+     *   destruction of the given components.
+     *
+     * @note
+     * Consider to use the `prepare` member function to initialize the internal
+     * data structures used by owning groups when the registry is still empty.
+     * Initialization could be a costly operation otherwise and it will be
+     * performed the very first time each group is created.
+     *
+     * @see View
+     * @see View<Entity, Component>
+     * @see PersistentView
+     * @see RawView
+     * @see Group
+     *
+     * @tparam Component Types of components owned by the group.
+     * @return A newly created owning group.
+     */
+    template<typename... Component>
+    Group<Entity, Component...> view(group_t) {
+        prepare<Component...>(group_t{});
+        const auto gtype = group_family::type<Component...>();
+        return Group<Entity, Component...>{*groups[gtype], pool<Component>()...};
+    }
+
     /**
      * @brief Returns a raw view for the given component.
      *
@@ -1416,6 +2210,48 @@ public:
         return RawView<Entity, Component>{pool<Component>()};
     }
 
+    /**
+     * @brief Returns a runtime view for the given components.
+     *
+     * This kind of views are created on the fly and share with the registry its
+     * internal data structures.<br/>
+     * Users should throw away the view after use. Fortunately, creating and
+     * destroying a runtime view is an incredibly cheap operation because they
+     * do not require any type of initialization.<br/>
+     * As a rule of thumb, storing a view should never be an option.
+     *
+     * Runtime views are well suited when users want to construct a view from
+     * some external inputs and don't know at compile-time what are the required
+     * components.<br/>
+     * This is particularly well suited to plugin systems and mods in general.
+     *
+     * @note
+     * Components that have never been assigned to an entity don't have a pool
+     * yet. Runtime views built with them are empty.
+     *
+     * @see View
+     * @see View<Entity, Component>
+     * @see PersistentView
+     * @see RawView
+     * @see RuntimeView
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range of components.
+     * @param last An iterator past the last element of the range of components.
+     * @return A newly created runtime view.
+     */
+    template<typename It>
+    RuntimeView<Entity> runtime_view(It first, It last) const {
+        static_assert(std::is_convertible<typename std::iterator_traits<It>::value_type, component_type>::value, "!");
+        std::vector<const view_type *> set(std::distance(first, last));
+
+        std::transform(first, last, set.begin(), [this](const component_type ctype) {
+            return ctype < pools.size() ? std::get<0>(pools[ctype]).get() : nullptr;
+        });
+
+        return RuntimeView<Entity>{std::move(set)};
+    }
+
     /**
      * @brief Returns a temporary object to use to create snapshots.
      *
@@ -1451,11 +2287,13 @@ public:
      * @warning
      * The loader returned by this function requires that the registry be empty.
      * In case it isn't, all the data will be automatically deleted before to
-     * return.
+     * return. Signatures are enabled again afterwards if they were.
      *
      * @return A temporary object to use to load snasphosts.
      */
     SnapshotLoader<Entity> restore() {
+        assert(!locked);
+
         using assure_fn_type = void(*)(Registry &, const entity_type, const bool);
 
         assure_fn_type assure = [](Registry &registry, const entity_type entity, const bool destroyed) {
@@ -1479,14 +2317,24 @@ public:
             }
         };
 
-        return { (*this = {}), assure };
+        // signatures survive the reset, they are a setting and not a state
+        const auto enabled = signatures();
+        *this = {};
+        signatures(enabled);
+
+        return { *this, assure };
     }
 
 private:
-    std::vector<std::unique_ptr<SparseSet<Entity>>> handlers;
-    std::vector<std::tuple<std::unique_ptr<SparseSet<Entity>>, signal_type, signal_type>> pools;
-    std::vector<std::tuple<std::unique_ptr<Attachee>, signal_type, signal_type>> tags;
-    std::vector<entity_type> entities;
+    std::vector<handler_type, Allocator<handler_type>> handlers;
+    std::vector<group_type, Allocator<group_type>> groups;
+    std::vector<bool, Allocator<bool>> owned;
+    std::vector<pool_type, Allocator<pool_type>> pools;
+    std::vector<tag_data_type, Allocator<tag_data_type>> tags;
+    std::vector<entity_type, Allocator<entity_type>> entities;
+    std::vector<mask_type, Allocator<mask_type>> masks;
+    std::size_t words{};
+    bool locked{};
     size_type available{};
     entity_type next{};
 };
@@ -3,14 +3,15 @@
 
 
 #include <array>
+#include <vector>
 #include <cstddef>
 #include <utility>
 #include <cassert>
 #include <iterator>
 #include <type_traits>
-#include <unordered_map>
 #include "../config/config.h"
 #include "entt_traits.hpp"
+#include "sparse_set.hpp"
 #include "utility.hpp"
 
 
@@ -24,6 +25,41 @@ template<typename>
 class Registry;
 
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+template<typename Archive, typename Pointer, typename = void>
+struct has_block: std::false_type {};
+
+
+template<typename Archive, typename Pointer>
+struct has_block<Archive, Pointer, decltype(std::declval<Archive &>().block(std::declval<Pointer>(), std::size_t{}), void())>: std::true_type {};
+
+
+// components are moved in blocks only if they are stored in a plain array and can be copied byte by byte
+template<typename Entity, typename Type, typename Archive, typename Pointer>
+using is_bulk = std::integral_constant<bool,
+    has_block<Archive, Pointer>::value
+    && std::is_trivially_copyable<Type>::value
+    && std::is_same<typename SparseSet<Entity, Type>::const_pointer_type, const Type *>::value
+>;
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond TURN_OFF_DOXYGEN
+ */
+
+
 /**
  * @brief Utility class to create snapshots from a registry.
  *
@@ -47,33 +83,64 @@ class Snapshot final {
           follow{follow}
     {}
 
-    template<typename Component, typename Archive, typename It>
-    void get(Archive &archive, std::size_t sz, It first, It last) const {
-        archive(static_cast<Entity>(sz));
+    template<typename Component, typename Archive>
+    void put(Archive &archive, const std::size_t sz, const Entity *entities, std::false_type) const {
+        for(std::size_t pos{}; pos < sz; ++pos) {
+            const auto entity = entities[pos];
+            archive(entity, registry.template get<Component>(entity));
+        }
+    }
 
-        while(first != last) {
-            const auto entity = *(first++);
+    template<typename Component, typename Archive>
+    void put(Archive &archive, const std::size_t sz, const Entity *entities, std::true_type) const {
+        archive.block(entities, sz);
+
+        if(!std::is_empty<Component>::value) {
+            // entities and components are packed in the same order, the pool is written as it is
+            archive.block(registry.template raw<Component>(), sz);
+        }
+    }
+
+    template<typename Component, typename Archive>
+    void get(Archive &archive, const std::vector<Entity> &entities, std::false_type) const {
+        archive(static_cast<Entity>(entities.size()));
+
+        for(const auto entity: entities) {
+            archive(entity, registry.template get<Component>(entity));
+        }
+    }
+
+    template<typename Component, typename Archive>
+    void get(Archive &archive, const std::vector<Entity> &entities, std::true_type) const {
+        archive(static_cast<Entity>(entities.size()));
+        archive.block(entities.data(), entities.size());
+
+        if(!std::is_empty<Component>::value) {
+            std::vector<Component> instances;
+            instances.reserve(entities.size());
 
-            if(registry.template has<Component>(entity)) {
-                archive(entity, registry.template get<Component>(entity));
+            for(const auto entity: entities) {
+                instances.push_back(registry.template get<Component>(entity));
             }
+
+            archive.block(instances.data(), instances.size());
         }
     }
 
     template<typename... Component, typename Archive, typename It, std::size_t... Indexes>
     void component(Archive &archive, It first, It last, std::index_sequence<Indexes...>) const {
-        std::array<std::size_t, sizeof...(Indexes)> size{};
-        auto begin = first;
+        // sizes must be written before data, entities are sorted out per type in a single pass
+        std::array<std::vector<Entity>, sizeof...(Indexes)> entities{};
 
-        while(begin != last) {
-            const auto entity = *(begin++);
-            using accumulator_type = std::size_t[];
-            accumulator_type accumulator = { (registry.template has<Component>(entity) ? ++size[Indexes] : size[Indexes])... };
+        while(first != last) {
+            const auto entity = *(first++);
+            using accumulator_type = int[];
+            accumulator_type accumulator = { (registry.template has<Component>(entity) ? (entities[Indexes].push_back(entity), 0) : 0)... };
             (void)accumulator;
         }
 
         using accumulator_type = int[];
-        accumulator_type accumulator = { (get<Component>(archive, size[Indexes], first, last), 0)... };
+        accumulator_type accumulator = { (get<Component>(archive, entities[Indexes], internal::is_bulk<Entity, Component, Archive, const Component *>{}), 0)... };
         (void)accumulator;
     }
 
@@ -146,11 +213,7 @@ public:
         const auto *entities = registry.template data<Component>();
 
         archive(static_cast<Entity>(sz));
-
-        for(std::remove_const_t<decltype(sz)> i{}; i < sz; ++i) {
-            const auto entity = entities[i];
-            archive(entity, registry.template get<Component>(entity));
-        };
+        put<Component>(archive, sz, entities, internal::is_bulk<Entity, Component, Archive, const Component *>{});
 
         return *this;
     }
@@ -179,7 +242,9 @@ public:
      * @brief Puts aside the given components for the entities in a range.
      *
      * Each instance is serialized together with the entity to which it belongs.
-     * Entities are serialized along with their versions.
+     * Entities are serialized along with their versions.<br/>
+     * The range is visited only once, therefore single pass input iterators
+     * are fine.
      *
      * @tparam Component Types of components to serialize.
      * @tparam Archive Type of output archive.
@@ -299,6 +364,40 @@ class SnapshotLoader final {
         }
     }
 
+    template<typename Type, typename Archive>
+    void assign(Archive &archive, std::false_type) const {
+        assign<Type>(archive);
+    }
+
+    template<typename Type, typename Archive>
+    void assign(Archive &archive, std::true_type) const {
+        Entity length{};
+        archive(length);
+
+        std::vector<Entity> entities(length);
+        archive.block(entities.data(), entities.size());
+
+        for(const auto entity: entities) {
+            static constexpr auto destroyed = false;
+            assure_fn(registry, entity, destroyed);
+        }
+
+        // the pool is grown at once and its sparse array is rebuilt in a single pass
+        auto *raw = registry.template assign<Type>(entities.cbegin(), entities.cend());
+
+        if(!std::is_empty<Type>::value) {
+            if(raw) {
+                // instances are read in place into the tail of the pool
+                archive.block(raw, length);
+            } else {
+                // owning groups rearrange their pools, the components are read one at a time
+                for(const auto entity: entities) {
+                    archive.block(&registry.template get<Type>(entity), 1);
+                }
+            }
+        }
+    }
+
 public:
     /*! @brief Copying a snapshot loader isn't allowed. */
     SnapshotLoader(const SnapshotLoader &) = delete;
@@ -350,7 +449,9 @@ public:
      * The template parameter list must be exactly the same used during
      * serialization. In the event that the entity to which the component is
      * assigned doesn't exist yet, the loader will take care to create it with
-     * the version it originally had.
+     * the version it originally had.<br/>
+     * Components written in blocks are read in place into their pools, that
+     * is after listeners have been notified of their construction.
      *
      * @tparam Component Types of components to restore.
      * @tparam Archive Type of input archive.
@@ -360,7 +461,7 @@ public:
     template<typename... Component, typename Archive>
     const SnapshotLoader & component(Archive &archive) const {
         using accumulator_type = int[];
-        accumulator_type accumulator = { 0, (assign<Component>(archive), 0)... };
+        accumulator_type accumulator = { 0, (assign<Component>(archive, internal::is_bulk<Entity, Component, Archive, Component *>{}), 0)... };
         (void)accumulator;
         return *this;
     }
@@ -430,30 +531,40 @@ template<typename Entity>
 class ContinuousLoader final {
     using traits_type = entt_traits<Entity>;
 
-    void destroy(Entity entity) {
-        const auto it = remloc.find(entity);
+    void retire(Entity entity) {
+        // remote identifiers are recycled, older versions are kept aside until the next shrink
+        if(remloc.has(entity)) {
+            const auto remote = remloc.data()[remloc.SparseSet<Entity>::get(entity)];
+
+            // only the latest older version of an identifier is worth keeping
+            if(stale.has(remote)) {
+                release(stale.get(remote));
+                stale.destroy(remote);
+            }
+
+            stale.construct(remote, remloc.get(entity).first);
+            remloc.destroy(entity);
+        }
+    }
 
-        if(it == remloc.cend()) {
+    void destroy(Entity entity) {
+        if(!has(entity)) {
+            retire(entity);
             const auto local = registry.create();
-            remloc.emplace(entity, std::make_pair(local, true));
+            remloc.construct(entity, local, true);
             registry.destroy(local);
         }
     }
 
     void restore(Entity entity) {
-        const auto it = remloc.find(entity);
-
-        if(it == remloc.cend()) {
-            const auto local = registry.create();
-            remloc.emplace(entity, std::make_pair(local, true));
-        } else {
-            remloc[entity].first =
-                    registry.valid(remloc[entity].first)
-                    ? remloc[entity].first
-                    : registry.create();
-
+        if(current(entity)) {
+            auto &ref = remloc.get(entity);
+            ref.first = registry.valid(ref.first) ? ref.first : registry.create();
             // set the dirty flag
-            remloc[entity].second = true;
+            ref.second = true;
+        } else {
+            retire(entity);
+            remloc.construct(entity, registry.create(), true);
         }
     }
 
@@ -487,15 +598,64 @@ class ContinuousLoader final {
         }
     }
 
+    void release(Entity local) {
+        if(registry.valid(local)) {
+            registry.destroy(local);
+        }
+    }
+
+    void purge(Entity entity) {
+        if(current(entity)) {
+            release(remloc.get(entity).first);
+            remloc.destroy(entity);
+        } else if(outdated(entity)) {
+            release(stale.get(entity));
+            stale.destroy(entity);
+        }
+    }
+
+    bool current(Entity entity) const ENTT_NOEXCEPT {
+        return remloc.has(entity) && (remloc.data()[remloc.SparseSet<Entity>::get(entity)] == entity);
+    }
+
+    bool outdated(Entity entity) const ENTT_NOEXCEPT {
+        return stale.has(entity) && (stale.data()[stale.SparseSet<Entity>::get(entity)] == entity);
+    }
+
+    template<typename Component, typename Archive>
+    void remove(Archive &archive) {
+        Entity length{};
+        archive(length);
+
+        while(length--) {
+            Entity entity{};
+            archive(entity);
+
+            if(has(entity)) {
+                const auto local = map(entity);
+
+                if(registry.valid(local)) {
+                    registry.template reset<Component>(local);
+                }
+            }
+        }
+    }
+
     template<typename Component>
     void reset() {
         for(auto &&ref: remloc) {
-            const auto local = ref.second.first;
+            const auto local = ref.first;
 
             if(registry.valid(local)) {
                 registry.template reset<Component>(local);
             }
         }
+
+        for(const auto local: stale) {
+            if(registry.valid(local)) {
+                registry.template reset<Component>(local);
+            }
+        }
     }
 
     template<typename Other, typename Archive, typename Func, typename... Type, typename... Member>
@@ -518,6 +678,36 @@ class ContinuousLoader final {
         }
     }
 
+    template<typename Other, typename Archive, typename Func, typename... Type, typename... Member>
+    void assign(Archive &archive, Func func, std::false_type, Member Type:: *... member) {
+        assign<Other>(archive, std::move(func), member...);
+    }
+
+    template<typename Other, typename Archive, typename Func, typename... Type, typename... Member>
+    void assign(Archive &archive, Func func, std::true_type, Member Type:: *... member) {
+        Entity length{};
+        archive(length);
+
+        std::vector<Entity> entities(length);
+        std::vector<Other> instances(std::is_empty<Other>::value ? 0 : length);
+        archive.block(entities.data(), entities.size());
+
+        if(!std::is_empty<Other>::value) {
+            archive.block(instances.data(), instances.size());
+        }
+
+        for(std::size_t pos{}; pos < entities.size(); ++pos) {
+            Other instance = std::is_empty<Other>::value ? Other{} : instances[pos];
+            restore(entities[pos]);
+
+            using accumulator_type = int[];
+            accumulator_type accumulator = { 0, (update(instance, member), 0)... };
+            (void)accumulator;
+
+            func(map(entities[pos]), instance);
+        }
+    }
+
 public:
     /*! @brief Underlying entity identifier. */
     using entity_type = Entity;
@@ -527,7 +717,9 @@ public:
      * @param registry A valid reference to a registry.
      */
     ContinuousLoader(Registry<entity_type> &registry) ENTT_NOEXCEPT
-        : registry{registry}
+        : remloc{registry.resource()},
+          stale{registry.resource()},
+          registry{registry}
     {}
 
     /*! @brief Copying a snapshot loader isn't allowed. */
@@ -598,7 +790,64 @@ public:
         };
 
         using accumulator_type = int[];
-        accumulator_type accumulator = { 0, (reset<Component>(), assign<Component>(archive, apply, member...), 0)... };
+        accumulator_type accumulator = { 0, (reset<Component>(), assign<Component>(archive, apply, internal::is_bulk<Entity, Component, Archive, Component *>{}, member...), 0)... };
+        (void)accumulator;
+        return *this;
+    }
+
+    /**
+     * @brief Destroys the local counterparts of entities destroyed remotely.
+     *
+     * This function reads the entities put aside by the `destroyed` member
+     * function of a delta. Their local counterparts are destroyed and the
+     * loader forgets about them.
+     *
+     * @tparam Archive Type of input archive.
+     * @param archive A valid reference to an input archive.
+     * @return A non-const reference to this loader.
+     */
+    template<typename Archive>
+    ContinuousLoader & purge(Archive &archive) {
+        assure(archive, &ContinuousLoader::purge);
+        return *this;
+    }
+
+    /**
+     * @brief Applies changes to components and assigns them to the right
+     * entities.
+     *
+     * This function reads the changes put aside by the `component` member
+     * function of a delta. The template parameter list must be exactly the
+     * same used during serialization.<br/>
+     * Components constructed or updated remotely are either assigned to or
+     * replaced on the local counterparts of their entities, while components
+     * removed remotely are removed also locally. Components of entities that
+     * don't appear in the delta are left untouched.<br/>
+     * Members can be either data members of type entity_type or containers of
+     * entities. In both cases, the loader will visit them and update the
+     * entities by replacing each one with its local counterpart.
+     *
+     * @warning
+     * Entities that don't appear in a delta aren't marked as dirty. Therefore
+     * `shrink` shouldn't be used after applying a delta. Use `prune` instead to
+     * release older versions of recycled identifiers.
+     *
+     * @tparam Component Type of component to restore.
+     * @tparam Archive Type of input archive.
+     * @tparam Type Types of components to update with local counterparts.
+     * @tparam Member Types of members to update with their local counterparts.
+     * @param archive A valid reference to an input archive.
+     * @param member Members to update with their local counterparts.
+     * @return A non-const reference to this loader.
+     */
+    template<typename... Component, typename Archive, typename... Type, typename... Member>
+    ContinuousLoader & delta(Archive &archive, Member Type:: *... member) {
+        auto apply = [this](const auto entity, const auto &component) {
+            registry.template accommodate<std::decay_t<decltype(component)>>(entity, component);
+        };
+
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (assign<Component>(archive, apply, internal::is_bulk<Entity, Component, Archive, Component *>{}, member...), remove<Component>(archive), 0)... };
         (void)accumulator;
         return *this;
     }
@@ -643,24 +892,42 @@ public:
      * @return A non-const reference to this loader.
      */
     ContinuousLoader & shrink() {
-        auto it = remloc.begin();
-
-        while(it != remloc.cend()) {
-            const auto local = it->second.first;
-            bool &dirty = it->second.second;
+        // backwards, so that removed elements are replaced by visited ones
+        for(auto pos = remloc.size(); pos; --pos) {
+            const auto entity = remloc.data()[pos - 1];
+            bool &dirty = remloc.get(entity).second;
 
             if(dirty) {
                 dirty = false;
-                ++it;
             } else {
-                if(registry.valid(local)) {
-                    registry.destroy(local);
-                }
-
-                it = remloc.erase(it);
+                release(remloc.get(entity).first);
+                remloc.destroy(entity);
             }
         }
 
+        return prune();
+    }
+
+    /**
+     * @brief Releases the local counterparts of older versions of entities.
+     *
+     * When an identifier is recycled remotely, the loader keeps the local
+     * counterpart of the previous version until the next call to `shrink`, so
+     * that components that still refer to it can be restored. At most one
+     * older version is kept for each identifier.<br/>
+     * Users that apply deltas and therefore don't invoke `shrink` should invoke
+     * this member function once in a while instead, as an example when a delta
+     * has been applied in full.
+     *
+     * @return A non-const reference to this loader.
+     */
+    ContinuousLoader & prune() {
+        for(const auto local: stale) {
+            release(local);
+        }
+
+        stale.reset();
+
         return *this;
     }
 
@@ -688,7 +955,7 @@ public:
      * @return True if `entity` is managed by the loader, false otherwise.
      */
     bool has(entity_type entity) const ENTT_NOEXCEPT {
-        return (remloc.find(entity) != remloc.cend());
+        return current(entity) || outdated(entity);
     }
 
     /**
@@ -705,11 +972,12 @@ public:
      */
     entity_type map(entity_type entity) const ENTT_NOEXCEPT {
         assert(has(entity));
-        return remloc.find(entity)->second.first;
+        return current(entity) ? remloc.get(entity).first : stale.get(entity);
     }
 
 private:
-    std::unordered_map<Entity, std::pair<Entity, bool>> remloc;
+    SparseSet<Entity, std::pair<Entity, bool>> remloc;
+    SparseSet<Entity, Entity> stale;
     Registry<Entity> &registry;
 };
 
@@ -0,0 +1,629 @@
+#ifndef ENTT_ENTITY_SOA_HPP
+#define ENTT_ENTITY_SOA_HPP
+
+
+#include <tuple>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+#include "../config/config.h"
+#include "../core/memory.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Structure of arrays layout traits.
+ *
+ * Objects are stored as arrays of structures by default. Specializing this
+ * class for a type makes sparse sets lay its objects out as separate arrays,
+ * one for each of the data members returned by a static member function named
+ * `members`:
+ *
+ * @code{.cpp}
+ * namespace entt {
+ *     template<>
+ *     struct soa_traits<Transform> {
+ *         static auto members() ENTT_NOEXCEPT {
+ *             return std::make_tuple(&Transform::x, &Transform::y, &Transform::angle);
+ *         }
+ *     };
+ * }
+ * @endcode
+ *
+ * Data members that aren't listed aren't stored. Types laid out this way must
+ * be default constructible and their data members must be copy assignable.<br/>
+ * Data members of type `bool` are stored one per byte rather than in a
+ * `std::vector<bool>`, so that their arrays can be accessed directly as well.
+ * Such arrays are made of small wrappers that convert to and from `bool`.
+ *
+ * @tparam Type Type of objects.
+ */
+template<typename Type, typename = void>
+struct soa_traits {};
+
+
+template<typename, bool>
+class SoaReference;
+
+
+template<typename, bool>
+class SoaPointer;
+
+
+template<typename>
+class SoaStorage;
+
+
+namespace internal {
+
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+template<typename, typename = void>
+struct is_soa: std::false_type {};
+
+
+template<typename Type>
+struct is_soa<Type, decltype(void(soa_traits<Type>::members()))>: std::true_type {};
+
+
+template<typename>
+struct soa_member;
+
+
+template<typename Member, typename Class>
+struct soa_member<Member Class::*> {
+    using type = Member;
+};
+
+
+struct soa_boolean {
+    soa_boolean(const bool value = {}) ENTT_NOEXCEPT
+        : value{value}
+    {}
+
+    operator bool &() ENTT_NOEXCEPT {
+        return value;
+    }
+
+    operator const bool &() const ENTT_NOEXCEPT {
+        return value;
+    }
+
+    bool value;
+};
+
+
+template<typename Member>
+struct soa_element {
+    using type = Member;
+};
+
+
+// std::vector<bool> packs bits and has no data member function
+template<>
+struct soa_element<bool> {
+    using type = soa_boolean;
+};
+
+
+template<typename Member>
+Member & soa_value(Member &member) ENTT_NOEXCEPT {
+    return member;
+}
+
+
+inline bool & soa_value(soa_boolean &member) ENTT_NOEXCEPT {
+    return member.value;
+}
+
+
+inline const bool & soa_value(const soa_boolean &member) ENTT_NOEXCEPT {
+    return member.value;
+}
+
+
+template<typename Type, typename = decltype(soa_traits<Type>::members())>
+struct soa_arrays;
+
+
+template<typename Type, typename... Member>
+struct soa_arrays<Type, std::tuple<Member...>> {
+    using type = std::tuple<std::vector<typename soa_element<typename soa_member<Member>::type>::type, Allocator<typename soa_element<typename soa_member<Member>::type>::type>>...>;
+};
+
+
+template<typename Type>
+SoaReference<Type, false> unconst(const SoaReference<Type, true> &) ENTT_NOEXCEPT;
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond TURN_OFF_DOXYGEN
+ */
+
+
+}
+
+
+/**
+ * @brief Reference to an object laid out as a structure of arrays.
+ *
+ * Proxy object that refers to the data members of an object scattered across
+ * the arrays of a sparse set (see soa_traits for more details). Assigning an
+ * object or another reference to it copies the data members in place, the same
+ * as an actual reference would do.
+ *
+ * @tparam Type Type of objects.
+ * @tparam Const True for references to constant objects, false otherwise.
+ */
+template<typename Type, bool Const>
+class SoaReference final {
+    template<typename, bool>
+    friend class SoaReference;
+
+    template<typename Other>
+    friend SoaReference<Other, false> internal::unconst(const SoaReference<Other, true> &) ENTT_NOEXCEPT;
+
+    using storage_type = std::conditional_t<Const, const SoaStorage<Type>, SoaStorage<Type>>;
+    using members_type = decltype(soa_traits<Type>::members());
+
+    template<typename Other, std::size_t... Index>
+    void assign(const Other &other, std::index_sequence<Index...>) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (get<Index>() = other.template get<Index>(), 0)... };
+        (void)accumulator;
+    }
+
+    template<std::size_t... Index>
+    void store(const Type &value, std::index_sequence<Index...>) {
+        const auto members = soa_traits<Type>::members();
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (get<Index>() = value.*std::get<Index>(members), 0)... };
+        (void)accumulator;
+    }
+
+    template<std::size_t... Index>
+    Type load(std::index_sequence<Index...>) const {
+        const auto members = soa_traits<Type>::members();
+        Type value{};
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (value.*std::get<Index>(members) = get<Index>(), 0)... };
+        (void)accumulator;
+        return value;
+    }
+
+    template<std::size_t... Index>
+    void exchange(const SoaReference &other, std::index_sequence<Index...>) const {
+        using std::swap;
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (swap(get<Index>(), other.template get<Index>()), 0)... };
+        (void)accumulator;
+    }
+
+public:
+    /**
+     * @brief Constructs a reference to an object.
+     * @param storage The arrays in which the object is laid out.
+     * @param pos The position of the object in the arrays.
+     */
+    SoaReference(storage_type &storage, const std::size_t pos) ENTT_NOEXCEPT
+        : storage{&storage}, pos{pos}
+    {}
+
+    /**
+     * @brief Constructs a reference to a constant object from a reference to
+     * the same object.
+     * @tparam Other Dummy template parameter used for internal purposes.
+     * @param other A valid reference.
+     */
+    template<bool Other, typename = std::enable_if_t<Const && !Other>>
+    SoaReference(const SoaReference<Type, Other> &other) ENTT_NOEXCEPT
+        : storage{other.storage}, pos{other.pos}
+    {}
+
+    /*! @brief Default copy constructor, the object referred isn't copied. */
+    SoaReference(const SoaReference &) = default;
+
+    /**
+     * @brief Copies the data members of an object to the object referred.
+     * @param other A reference to the object to copy.
+     * @return This reference.
+     */
+    SoaReference & operator=(const SoaReference &other) {
+        return assign(other, std::make_index_sequence<std::tuple_size<members_type>::value>{}), *this;
+    }
+
+    /**
+     * @brief Copies the data members of an object to the object referred.
+     * @tparam Other True for references to constant objects, false otherwise.
+     * @param other A reference to the object to copy.
+     * @return This reference.
+     */
+    template<bool Other>
+    SoaReference & operator=(const SoaReference<Type, Other> &other) {
+        return assign(other, std::make_index_sequence<std::tuple_size<members_type>::value>{}), *this;
+    }
+
+    /**
+     * @brief Copies the data members of an object to the object referred.
+     * @param value An object to copy.
+     * @return This reference.
+     */
+    SoaReference & operator=(const Type &value) {
+        return store(value, std::make_index_sequence<std::tuple_size<members_type>::value>{}), *this;
+    }
+
+    /**
+     * @brief Returns a copy of the object referred.
+     * @return A copy of the object referred.
+     */
+    explicit operator Type() const {
+        return load(std::make_index_sequence<std::tuple_size<members_type>::value>{});
+    }
+
+    /**
+     * @brief Returns a data member of the object referred.
+     * @tparam Index Position of the data member in the list returned by
+     * `soa_traits<Type>::members`.
+     * @return A reference to the data member.
+     */
+    template<std::size_t Index>
+    decltype(auto) get() const ENTT_NOEXCEPT {
+        return internal::soa_value(storage->template data<Index>()[pos]);
+    }
+
+    /**
+     * @brief Swaps the data members of the objects referred.
+     * @param lhs A valid reference.
+     * @param rhs A valid reference.
+     */
+    friend void swap(const SoaReference &lhs, const SoaReference &rhs) {
+        lhs.exchange(rhs, std::make_index_sequence<std::tuple_size<members_type>::value>{});
+    }
+
+private:
+    storage_type *storage;
+    std::size_t pos;
+};
+
+
+/**
+ * @brief Pointer to an array of objects laid out as a structure of arrays.
+ *
+ * Proxy object that refers to a position within the arrays of a sparse set
+ * (see soa_traits for more details). It offers both access to the objects and
+ * direct access to the arrays of data members, as an example to stream a single
+ * data member at a time.
+ *
+ * @tparam Type Type of objects.
+ * @tparam Const True for pointers to constant objects, false otherwise.
+ */
+template<typename Type, bool Const>
+class SoaPointer final {
+    template<typename, bool>
+    friend class SoaPointer;
+
+    using storage_type = std::conditional_t<Const, const SoaStorage<Type>, SoaStorage<Type>>;
+
+    struct Arrow {
+        const SoaReference<Type, Const> * operator->() const ENTT_NOEXCEPT {
+            return &ref;
+        }
+
+        const SoaReference<Type, Const> ref;
+    };
+
+public:
+    /*! @brief Type of reference to the objects. */
+    using reference = SoaReference<Type, Const>;
+
+    /*! @brief Constructs a null pointer. */
+    SoaPointer(std::nullptr_t = nullptr) ENTT_NOEXCEPT
+        : storage{}, offset{}
+    {}
+
+    /**
+     * @brief Constructs a pointer to a position within some arrays.
+     * @param storage The arrays in which the objects are laid out.
+     * @param offset The position of the first object.
+     */
+    SoaPointer(storage_type &storage, const std::size_t offset) ENTT_NOEXCEPT
+        : storage{&storage}, offset{offset}
+    {}
+
+    /**
+     * @brief Constructs a pointer to constant objects from a pointer to the
+     * same objects.
+     * @tparam Other Dummy template parameter used for internal purposes.
+     * @param other A valid pointer.
+     */
+    template<bool Other, typename = std::enable_if_t<Const && !Other>>
+    SoaPointer(const SoaPointer<Type, Other> &other) ENTT_NOEXCEPT
+        : storage{other.storage}, offset{other.offset}
+    {}
+
+    /**
+     * @brief Returns the array of the given data member.
+     * @tparam Index Position of the data member in the list returned by
+     * `soa_traits<Type>::members`.
+     * @return A pointer to the data member of the object pointed to, or a null
+     * pointer if this is a null pointer.
+     */
+    template<std::size_t Index>
+    auto get() const ENTT_NOEXCEPT {
+        return storage ? (storage->template data<Index>() + offset) : nullptr;
+    }
+
+    /**
+     * @brief Returns a reference to an object.
+     * @param pos Position of the object, relative to the one pointed to.
+     * @return A reference to the object.
+     */
+    reference operator[](const std::size_t pos) const ENTT_NOEXCEPT {
+        return reference{*storage, offset + pos};
+    }
+
+    /**
+     * @brief Returns a reference to the object pointed to.
+     * @return A reference to the object.
+     */
+    reference operator*() const ENTT_NOEXCEPT {
+        return reference{*storage, offset};
+    }
+
+    /**
+     * @brief Gives access to the object pointed to.
+     *
+     * The proxy returned keeps a reference to the object alive for the
+     * duration of the expression, so that `ptr->get<N>()` works as expected.
+     *
+     * @return A proxy object that forwards member access to a reference.
+     */
+    Arrow operator->() const ENTT_NOEXCEPT {
+        return Arrow{reference{*storage, offset}};
+    }
+
+    /**
+     * @brief Returns a pointer to an object following the one pointed to.
+     * @param value Number of positions to move forward.
+     * @return A pointer to the object.
+     */
+    SoaPointer operator+(const std::size_t value) const ENTT_NOEXCEPT {
+        return SoaPointer{*storage, offset + value};
+    }
+
+    /**
+     * @brief Checks whether a pointer is a null pointer.
+     * @return False if the pointer is a null pointer, true otherwise.
+     */
+    explicit operator bool() const ENTT_NOEXCEPT {
+        return storage != nullptr;
+    }
+
+    /**
+     * @brief Compares two pointers.
+     * @param other A valid pointer.
+     * @return True if the pointers point to the same object, false otherwise.
+     */
+    bool operator==(const SoaPointer &other) const ENTT_NOEXCEPT {
+        return storage == other.storage && offset == other.offset;
+    }
+
+    /**
+     * @brief Compares two pointers.
+     * @param other A valid pointer.
+     * @return False if the pointers point to the same object, true otherwise.
+     */
+    inline bool operator!=(const SoaPointer &other) const ENTT_NOEXCEPT {
+        return !(*this == other);
+    }
+
+private:
+    storage_type *storage;
+    std::size_t offset;
+};
+
+
+/**
+ * @brief Storage for objects laid out as a structure of arrays.
+ *
+ * This class is used internally by sparse sets to store the objects of types
+ * for which soa_traits is specialized. Users should not care of it.
+ *
+ * @tparam Type Type of objects.
+ */
+template<typename Type>
+class SoaStorage final {
+    using arrays_type = typename internal::soa_arrays<Type>::type;
+    using index_type = std::make_index_sequence<std::tuple_size<arrays_type>::value>;
+
+    static_assert(std::tuple_size<arrays_type>::value, "!");
+
+    template<std::size_t... Index>
+    SoaStorage(const Allocator<Type> &allocator, std::index_sequence<Index...>)
+        : arrays{std::tuple_element_t<Index, arrays_type>(Allocator<typename std::tuple_element_t<Index, arrays_type>::value_type>{allocator})...}
+    {}
+
+    template<typename Func, std::size_t... Index>
+    void visit(Func func, std::index_sequence<Index...>) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (func(std::get<Index>(arrays), std::get<Index>(soa_traits<Type>::members())), 0)... };
+        (void)accumulator;
+    }
+
+public:
+    /*! @brief Type of pointer to the objects. */
+    using pointer = SoaPointer<Type, false>;
+    /*! @brief Type of pointer to the constant objects. */
+    using const_pointer = SoaPointer<Type, true>;
+    /*! @brief Type of reference to the objects. */
+    using reference = SoaReference<Type, false>;
+    /*! @brief Type of reference to the constant objects. */
+    using const_reference = SoaReference<Type, true>;
+
+    /**
+     * @brief Constructs an empty storage.
+     * @param allocator The allocator to use for all the arrays.
+     */
+    explicit SoaStorage(const Allocator<Type> &allocator)
+        : SoaStorage{allocator, index_type{}}
+    {}
+
+    /**
+     * @brief Increases the capacity of all the arrays.
+     * @param cap Desired capacity.
+     */
+    void reserve(const std::size_t cap) {
+        visit([cap](auto &array, auto) { array.reserve(cap); }, index_type{});
+    }
+
+    /**
+     * @brief Appends an object to the arrays.
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param args Parameters to use to construct the object.
+     */
+    template<typename... Args>
+    void emplace_back(Args &&... args) {
+        Type value(std::forward<Args>(args)...);
+        const auto sz = std::get<0>(arrays).size();
+        auto cap = std::get<0>(arrays).capacity();
+        visit([&cap](auto &array, auto) { cap = array.capacity() < cap ? array.capacity() : cap; }, index_type{});
+
+        if(cap == sz) {
+            // grows all the arrays first, so as not to leave them out of sync in case of exceptions
+            reserve(sz ? (2 * sz) : 1);
+        }
+
+        visit([&value](auto &array, auto member) { array.push_back(std::move(value.*member)); }, index_type{});
+    }
+
+    /*! @brief Removes the last object from the arrays. */
+    void pop_back() {
+        visit([](auto &array, auto) { array.pop_back(); }, index_type{});
+    }
+
+    /**
+     * @brief Resizes the arrays.
+     * @param sz The new number of objects.
+     * @param value An object to copy to initialize the new objects.
+     */
+    void resize(const std::size_t sz, const Type &value) {
+        visit([sz, &value](auto &array, auto member) { array.resize(sz, value.*member); }, index_type{});
+    }
+
+    /*! @brief Removes all the objects from the arrays. */
+    void clear() {
+        visit([](auto &array, auto) { array.clear(); }, index_type{});
+    }
+
+    /**
+     * @brief Returns a reference to the last object.
+     * @return A reference to the last object.
+     */
+    reference back() ENTT_NOEXCEPT {
+        return reference{*this, std::get<0>(arrays).size() - 1};
+    }
+
+    /**
+     * @brief Returns a reference to an object.
+     * @param pos A valid position.
+     * @return A reference to the object.
+     */
+    const_reference operator[](const std::size_t pos) const ENTT_NOEXCEPT {
+        return const_reference{*this, pos};
+    }
+
+    /**
+     * @brief Returns a reference to an object.
+     * @param pos A valid position.
+     * @return A reference to the object.
+     */
+    reference operator[](const std::size_t pos) ENTT_NOEXCEPT {
+        return reference{*this, pos};
+    }
+
+    /**
+     * @brief Returns a pointer to the first object.
+     * @return A pointer to the first object.
+     */
+    const_pointer data() const ENTT_NOEXCEPT {
+        return const_pointer{*this, 0};
+    }
+
+    /**
+     * @brief Returns a pointer to the first object.
+     * @return A pointer to the first object.
+     */
+    pointer data() ENTT_NOEXCEPT {
+        return pointer{*this, 0};
+    }
+
+    /**
+     * @brief Returns the array of the given data member.
+     * @tparam Index Position of the data member in the list returned by
+     * `soa_traits<Type>::members`.
+     * @return A pointer to the array of the data member.
+     */
+    template<std::size_t Index>
+    const auto * data() const ENTT_NOEXCEPT {
+        return std::get<Index>(arrays).data();
+    }
+
+    /**
+     * @brief Returns the array of the given data member.
+     * @tparam Index Position of the data member in the list returned by
+     * `soa_traits<Type>::members`.
+     * @return A pointer to the array of the data member.
+     */
+    template<std::size_t Index>
+    auto * data() ENTT_NOEXCEPT {
+        return std::get<Index>(arrays).data();
+    }
+
+private:
+    arrays_type arrays;
+};
+
+
+namespace internal {
+
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+template<typename Type>
+SoaReference<Type, false> unconst(const SoaReference<Type, true> &ref) ENTT_NOEXCEPT {
+    return SoaReference<Type, false>{const_cast<SoaStorage<Type> &>(*ref.storage), ref.pos};
+}
+
+
+template<typename Type, bool Const>
+SoaReference<Type, Const> element(const SoaPointer<Type, Const> raw, const std::size_t pos) ENTT_NOEXCEPT {
+    return raw[pos];
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond TURN_OFF_DOXYGEN
+ */
+
+
+}
+
+
+}
+
+
+#endif // ENTT_ENTITY_SOA_HPP
@@ -4,20 +4,110 @@
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
+#include <memory>
 #include <numeric>
 #include <utility>
 #include <vector>
 #include <cstddef>
+#include <cstdint>
 #include <cassert>
 #include <type_traits>
 #include "../config/config.h"
 #include "../core/algorithm.hpp"
+#include "../core/memory.hpp"
 #include "entt_traits.hpp"
+#include "soa.hpp"
 
 
 namespace entt {
 
 
+namespace internal {
+
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+template<typename Type>
+inline Type & element(Type *raw, const std::size_t pos) ENTT_NOEXCEPT {
+    // empty types share a single instance, there is no array to index
+    return std::is_empty<std::remove_const_t<Type>>::value ? *raw : raw[pos];
+}
+
+
+template<typename Type>
+inline Type * offset(Type *raw, const std::size_t pos) ENTT_NOEXCEPT {
+    return std::is_empty<std::remove_const_t<Type>>::value ? raw : (raw + pos);
+}
+
+
+template<typename Pointer>
+inline Pointer offset(Pointer raw, const std::size_t pos) ENTT_NOEXCEPT {
+    return raw + pos;
+}
+
+
+template<typename Type>
+inline void prefetch(const Type *raw, const std::size_t pos) ENTT_NOEXCEPT {
+    if(!std::is_empty<Type>::value) {
+        ENTT_PREFETCH(raw + pos);
+    }
+}
+
+
+template<typename Pointer>
+inline void prefetch(const Pointer, const std::size_t) ENTT_NOEXCEPT {}
+
+
+template<typename Type>
+inline Type & unconst(const Type &ref) ENTT_NOEXCEPT {
+    return const_cast<Type &>(ref);
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond TURN_OFF_DOXYGEN
+ */
+
+
+}
+
+
+/**
+ * @brief Alignment of the packed arrays of objects.
+ *
+ * Packed arrays of objects are aligned as their types by default. Specializing
+ * this class for a type increases the alignment of the packed arrays of its
+ * objects, as an example to use aligned loads and stores with SIMD instructions:
+ *
+ * @code{.cpp}
+ * namespace entt {
+ *     template<>
+ *     struct storage_alignment<Position>: std::integral_constant<std::size_t, 32> {};
+ * }
+ * @endcode
+ *
+ * Arrays that are over-aligned this way are also padded at the end, so that
+ * they always extend at least up to the next multiple of the alignment. Loads
+ * and stores of blocks of the same size as the alignment never exceed the
+ * arrays, therefore kernels don't need a scalar epilogue. The padding contains
+ * unspecified values that aren't part of the sparse set.
+ *
+ * @note
+ * The alignment must be a power of two. It's ignored for empty types and for
+ * types laid out as structure of arrays.
+ *
+ * @tparam Type Type of objects.
+ */
+template<typename Type, typename = void>
+struct storage_alignment: std::integral_constant<std::size_t, alignof(Type)> {};
+
+
 /**
  * @brief Sparse set.
  *
@@ -106,6 +196,33 @@ class SparseSet<Entity> {
     };
 
     static constexpr auto pending = ~typename traits_type::entity_type{};
+    static constexpr auto entt_per_page = ENTT_PAGE_SIZE / sizeof(typename traits_type::entity_type);
+
+    static_assert(entt_per_page && !(entt_per_page & (entt_per_page - 1)), "!");
+
+    using page_type = ResourcePtr<typename traits_type::entity_type[]>;
+
+    inline auto page(const Entity entity) const ENTT_NOEXCEPT {
+        return std::size_t((entity & traits_type::entity_mask) / entt_per_page);
+    }
+
+    inline auto offset(const Entity entity) const ENTT_NOEXCEPT {
+        return std::size_t(entity & (entt_per_page - 1));
+    }
+
+    auto assure(const std::size_t pos) {
+        if(!(pos < reverse.size())) {
+            reverse.resize(pos+1);
+        }
+
+        if(!reverse[pos]) {
+            const auto value = pending;
+            reverse[pos] = allocate_unique<typename traits_type::entity_type[]>(resource(), entt_per_page);
+            std::fill_n(reverse[pos].get(), entt_per_page, value);
+        }
+
+        return reverse[pos].get();
+    }
 
 public:
     /*! @brief Underlying entity identifier. */
@@ -120,7 +237,21 @@ public:
     using const_iterator_type = Iterator;
 
     /*! @brief Default constructor. */
-    SparseSet() ENTT_NOEXCEPT = default;
+    SparseSet() ENTT_NOEXCEPT
+        : SparseSet{default_resource()}
+    {}
+
+    /**
+     * @brief Constructs a sparse set that gets its memory from a resource.
+     *
+     * Both the internal packed array and the pages of the internal sparse
+     * array are allocated from the given resource.
+     *
+     * @param resource A valid memory resource.
+     */
+    explicit SparseSet(MemoryResource *resource) ENTT_NOEXCEPT
+        : reverse{Allocator<page_type>{resource}}, direct{Allocator<entity_type>{resource}}
+    {}
 
     /*! @brief Default destructor. */
     virtual ~SparseSet() ENTT_NOEXCEPT = default;
@@ -135,6 +266,14 @@ public:
     /*! @brief Default move assignment operator. @return This sparse set. */
     SparseSet & operator=(SparseSet &&) = default;
 
+    /**
+     * @brief Returns the memory resource used by a sparse set.
+     * @return A pointer to the memory resource.
+     */
+    MemoryResource * resource() const ENTT_NOEXCEPT {
+        return direct.get_allocator().resource();
+    }
+
     /**
      * @brief Increases the capacity of a sparse set.
      *
@@ -155,10 +294,15 @@ public:
      * Usually the size of the internal sparse array is equal or greater than
      * the one of the internal packed array.
      *
+     * @note
+     * The internal sparse array is paged and pages are allocated on demand.
+     * Therefore the extent is always a multiple of the size of a page, even
+     * though pages in the middle of the range might not be allocated at all.
+     *
      * @return Extent of the sparse set.
      */
     size_type extent() const ENTT_NOEXCEPT {
-        return reverse.size();
+        return reverse.size() * entt_per_page;
     }
 
     /**
@@ -307,9 +451,9 @@ public:
      * @return True if the sparse set contains the entity, false otherwise.
      */
     bool has(const entity_type entity) const ENTT_NOEXCEPT {
-        const auto pos = size_type(entity & traits_type::entity_mask);
+        const auto curr = page(entity);
         // testing against pending permits to avoid accessing the direct vector
-        return (pos < reverse.size()) && (reverse[pos] != pending);
+        return (curr < reverse.size()) && reverse[curr] && (reverse[curr][offset(entity)] != pending);
     }
 
     /**
@@ -330,10 +474,10 @@ public:
      * @return True if the sparse set contains the entity, false otherwise.
      */
     bool fast(const entity_type entity) const ENTT_NOEXCEPT {
-        const auto pos = size_type(entity & traits_type::entity_mask);
-        assert(pos < reverse.size());
+        const auto curr = page(entity);
+        assert(curr < reverse.size());
         // testing against pending permits to avoid accessing the direct vector
-        return (reverse[pos] != pending);
+        return reverse[curr] && (reverse[curr][offset(entity)] != pending);
     }
 
     /**
@@ -350,7 +494,24 @@ public:
      */
     pos_type get(const entity_type entity) const ENTT_NOEXCEPT {
         assert(has(entity));
-        return reverse[entity & traits_type::entity_mask];
+        return reverse[page(entity)][offset(entity)];
+    }
+
+    /**
+     * @brief Prefetches the slot of an entity in the sparse array.
+     *
+     * This is only a hint to move the data to the caches ahead of time, the
+     * sparse set isn't affected in any case. Nothing happens if the entity
+     * belongs to a page that doesn't exist.
+     *
+     * @param entity A valid entity identifier.
+     */
+    void prefetch(const entity_type entity) const ENTT_NOEXCEPT {
+        const auto curr = page(entity);
+
+        if(curr < reverse.size() && reverse[curr]) {
+            ENTT_PREFETCH(reverse[curr].get() + offset(entity));
+        }
     }
 
     /**
@@ -366,17 +527,43 @@ public:
      */
     void construct(const entity_type entity) {
         assert(!has(entity));
-        const auto pos = size_type(entity & traits_type::entity_mask);
-
-        if(!(pos < reverse.size())) {
-            const auto value = pending;
-            reverse.resize(pos+1, value);
-        }
-
-        reverse[pos] = pos_type(direct.size());
+        assure(page(entity))[offset(entity)] = pos_type(direct.size());
         direct.push_back(entity);
     }
 
+    /**
+     * @brief Assigns one or more entities to a sparse set.
+     *
+     * The internal packed array is filled contiguously and memory is allocated
+     * at most once for the whole range of entities.
+     *
+     * @note
+     * _Sfinae'd_ function.<br/>
+     * This version is used for iterators that aren't convertible to entity
+     * identifiers, so as not to clash with the overload for single entities.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the sparse set
+     * results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * sparse set already contains the given entity.
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename It>
+    std::enable_if_t<!std::is_convertible<It, entity_type>::value>
+    construct(It first, It last) {
+        auto next = direct.size();
+        direct.insert(direct.end(), first, last);
+
+        std::for_each(first, last, [next, this](const auto entity) mutable {
+            assert(!has(entity));
+            assure(page(entity))[offset(entity)] = pos_type(next++);
+        });
+    }
+
     /**
      * @brief Removes an entity from a sparse set.
      *
@@ -391,9 +578,9 @@ public:
     virtual void destroy(const entity_type entity) {
         assert(has(entity));
         const auto back = direct.back();
-        auto &candidate = reverse[entity & traits_type::entity_mask];
+        auto &candidate = reverse[page(entity)][offset(entity)];
         // swapping isn't required here, we are getting rid of the last element
-        reverse[back & traits_type::entity_mask] = candidate;
+        reverse[page(back)][offset(back)] = candidate;
         direct[candidate] = back;
         candidate = pending;
         direct.pop_back();
@@ -414,12 +601,12 @@ public:
      * @param lhs A valid position within the sparse set.
      * @param rhs A valid position within the sparse set.
      */
-    void swap(const pos_type lhs, const pos_type rhs) ENTT_NOEXCEPT {
+    virtual void swap(const pos_type lhs, const pos_type rhs) ENTT_NOEXCEPT {
         assert(lhs < direct.size());
         assert(rhs < direct.size());
         auto &src = direct[lhs];
         auto &dst = direct[rhs];
-        std::swap(reverse[src & traits_type::entity_mask], reverse[dst & traits_type::entity_mask]);
+        std::swap(reverse[page(src)][offset(src)], reverse[page(dst)][offset(dst)]);
         std::swap(src, dst);
     }
 
@@ -469,9 +656,26 @@ public:
         direct.clear();
     }
 
+protected:
+    /**
+     * @brief Puts an entity at a given position in the internal packed array.
+     *
+     * The entity previously at the given position isn't moved elsewhere. This
+     * function is meant for derived classes that rearrange all the entities at
+     * once and restore a consistent state before returning.
+     *
+     * @param pos A valid position within the sparse set.
+     * @param entity A valid entity identifier that belongs to the sparse set.
+     */
+    void place(const pos_type pos, const entity_type entity) ENTT_NOEXCEPT {
+        assert(pos < direct.size());
+        direct[pos] = entity;
+        reverse[page(entity)][offset(entity)] = pos;
+    }
+
 private:
-    std::vector<pos_type> reverse;
-    std::vector<entity_type> direct;
+    std::vector<page_type, Allocator<page_type>> reverse;
+    std::vector<entity_type, Allocator<entity_type>> direct;
 };
 
 
@@ -492,6 +696,18 @@ private:
  * iterate directly the internal packed array (see `raw` and `size` member
  * functions for that). Use `begin` and `end` instead.
  *
+ * @note
+ * Objects of empty types aren't stored at all. All the entities share a single
+ * default constructed instance, that is what is returned by `get` and visited
+ * by the iterators. Arguments used to construct objects of empty types are
+ * discarded and these types must be default constructible.
+ *
+ * @note
+ * Objects of types for which soa_traits is specialized are laid out as a
+ * structure of arrays, one array for each data member. In this case, `get`,
+ * `raw` and the iterators return proxy objects in place of actual references
+ * and pointers (see SoaReference and SoaPointer for more details).
+ *
  * @sa SparseSet<Entity>
  *
  * @tparam Entity A valid entity type (see entt_traits for more details).
@@ -501,12 +717,88 @@ template<typename Entity, typename Type>
 class SparseSet<Entity, Type>: public SparseSet<Entity> {
     using underlying_type = SparseSet<Entity>;
 
+    struct Zipped {
+        Type instance;
+        typename underlying_type::entity_type entity;
+    };
+
+    struct Shared {
+        // empty types don't require storage, all the entities share a single instance
+        explicit Shared(const Allocator<Type> &) ENTT_NOEXCEPT {}
+
+        template<typename... Args>
+        void emplace_back(Args &&...) ENTT_NOEXCEPT {}
+        void pop_back() ENTT_NOEXCEPT {}
+        void reserve(const std::size_t) ENTT_NOEXCEPT {}
+        void resize(const std::size_t, const Type &) ENTT_NOEXCEPT {}
+        void clear() ENTT_NOEXCEPT {}
+
+        Type & back() ENTT_NOEXCEPT { return instance; }
+        Type * data() ENTT_NOEXCEPT { return &instance; }
+        const Type * data() const ENTT_NOEXCEPT { return &instance; }
+        Type & operator[](const std::size_t) ENTT_NOEXCEPT { return instance; }
+        const Type & operator[](const std::size_t) const ENTT_NOEXCEPT { return instance; }
+
+        Type instance{};
+    };
+
+    struct Padded: std::vector<Type, AlignedAllocator<Type, storage_alignment<Type>::value>> {
+        using base_type = std::vector<Type, AlignedAllocator<Type, storage_alignment<Type>::value>>;
+        using base_type::base_type;
+
+        static std::size_t padded(const std::size_t sz) ENTT_NOEXCEPT {
+            // round up to the next multiple of the alignment, then to a whole number of elements
+            constexpr auto alignment = storage_alignment<Type>::value;
+            const auto bytes = (sz * sizeof(Type) + alignment - 1) / alignment * alignment;
+            return (bytes + sizeof(Type) - 1) / sizeof(Type);
+        }
+
+        void grow(const std::size_t sz) {
+            if(base_type::capacity() < padded(sz)) {
+                base_type::reserve(padded(std::max(sz, 2 * base_type::size())));
+            }
+        }
+
+        template<typename... Args>
+        void emplace_back(Args &&... args) {
+            grow(base_type::size() + 1);
+            base_type::emplace_back(std::forward<Args>(args)...);
+        }
+
+        void reserve(const std::size_t cap) {
+            base_type::reserve(padded(cap));
+        }
+
+        void resize(const std::size_t sz, const Type &value) {
+            grow(sz);
+            base_type::resize(sz, value);
+        }
+
+        template<typename It>
+        void insert(typename base_type::const_iterator pos, It first, It last) {
+            // growing invalidates the iterator, the offset is all it takes to get it back
+            const auto offset = pos - base_type::cbegin();
+            grow(base_type::size() + std::distance(first, last));
+            base_type::insert(base_type::cbegin() + offset, first, last);
+        }
+    };
+
+    using storage_type = std::conditional_t<
+        internal::is_soa<Type>::value,
+        SoaStorage<Type>,
+        std::conditional_t<
+            std::is_empty<Type>::value,
+            Shared,
+            std::conditional_t<(storage_alignment<Type>::value > alignof(Type)), Padded, std::vector<Type, Allocator<Type>>>
+        >
+    >;
+
     template<bool Const>
     struct Iterator final {
         using difference_type = std::size_t;
         using value_type = std::conditional_t<Const, const Type, Type>;
-        using pointer = value_type *;
-        using reference = value_type &;
+        using pointer = std::conditional_t<internal::is_soa<Type>::value, SoaPointer<Type, Const>, value_type *>;
+        using reference = std::conditional_t<internal::is_soa<Type>::value, SoaReference<Type, Const>, value_type &>;
         using iterator_category = std::input_iterator_tag;
 
         Iterator(pointer instances, std::size_t pos)
@@ -540,11 +832,11 @@ class SparseSet<Entity, Type>: public SparseSet<Entity> {
         }
 
         reference operator*() const ENTT_NOEXCEPT {
-            return instances[pos-1];
+            return internal::element(instances, pos-1);
         }
 
         pointer operator->() const ENTT_NOEXCEPT {
-            return (instances+pos-1);
+            return internal::offset(instances, pos-1);
         }
 
     private:
@@ -552,6 +844,133 @@ class SparseSet<Entity, Type>: public SparseSet<Entity> {
         std::size_t pos;
     };
 
+    template<typename Compare>
+    static auto unary(int) -> decltype(std::declval<Compare>()(std::declval<const Type &>()), std::true_type{});
+
+    template<typename>
+    static std::false_type unary(char);
+
+    template<typename It, typename Compare, typename Sort, typename Proj>
+    void arrange(It first, It last, Compare compare, Sort sort, Proj proj, std::true_type) {
+        // sparse sets are iterated backwards, elements are sorted in reverse order
+        sort(std::make_reverse_iterator(last), std::make_reverse_iterator(first), [compare = std::move(compare), proj](const auto &elem) {
+            return compare(proj(elem));
+        });
+    }
+
+    template<typename It, typename Compare, typename Sort, typename Proj>
+    void arrange(It first, It last, Compare compare, Sort sort, Proj proj, std::false_type) {
+        sort(first, last, [compare = std::move(compare), proj](const auto &lhs, const auto &rhs) {
+            return compare(proj(rhs), proj(lhs));
+        });
+    }
+
+    template<typename Compare, typename Sort>
+    void reorder(Compare compare, Sort sort, std::true_type) {
+        const auto *local = underlying_type::data();
+        zipped.clear();
+
+        for(typename underlying_type::pos_type pos = 0, last = underlying_type::size(); pos < last; ++pos) {
+            zipped.push_back(Zipped{Type(instances[pos]), local[pos]});
+        }
+
+        arrange(zipped.begin(), zipped.end(), std::move(compare), std::move(sort), [](const Zipped &elem) -> const Type & {
+            return elem.instance;
+        }, decltype(unary<Compare>(0)){});
+
+        for(typename underlying_type::pos_type pos = 0, last = zipped.size(); pos < last; ++pos) {
+            instances[pos] = zipped[pos].instance;
+            underlying_type::place(pos, zipped[pos].entity);
+        }
+    }
+
+    template<typename Compare, typename Sort>
+    void reorder(Compare compare, Sort sort, std::false_type) {
+        indexes.resize(underlying_type::size());
+        std::iota(indexes.begin(), indexes.end(), 0);
+
+        arrange(indexes.begin(), indexes.end(), std::move(compare), std::move(sort), [this](const auto pos) -> const Type & {
+            return instances[pos];
+        }, decltype(unary<Compare>(0)){});
+
+        permute();
+    }
+
+    template<typename Sort, typename Getter>
+    static auto keys(Sort &sort, std::uint64_t *first, std::uint64_t *last, Getter getter, std::vector<std::uint64_t, Allocator<std::uint64_t>> &aux, int)
+    -> decltype(sort(first, last, getter, aux), void()) {
+        sort(first, last, std::move(getter), aux);
+    }
+
+    template<typename Sort, typename Getter>
+    static void keys(Sort &sort, std::uint64_t *first, std::uint64_t *last, Getter getter, std::vector<std::uint64_t, Allocator<std::uint64_t>> &, char) {
+        sort(first, last, std::move(getter));
+    }
+
+    template<typename Compare, typename Sort, typename Zip>
+    void reorder(Compare compare, Sort sort, Zip, std::false_type) {
+        reorder(std::move(compare), std::move(sort), Zip{});
+    }
+
+    template<typename Compare, typename Sort, typename Zip>
+    void reorder(Compare compare, Sort sort, Zip, std::true_type) {
+        using pos_type = typename underlying_type::pos_type;
+        using key_type = std::decay_t<decltype(compare(std::declval<const Type &>()))>;
+        constexpr auto shift = std::numeric_limits<pos_type>::digits;
+        const pos_type sz = underlying_type::size();
+        std::uint64_t overflow{};
+        keyed.resize(sz);
+
+        // keys and positions are packed into a word each, laid out in the order in which sparse sets are iterated
+        for(pos_type pos = 0; pos < sz; ++pos) {
+            const pos_type from = sz - pos - 1;
+            const auto key = std::uint64_t(compare(static_cast<const Type &>(instances[from])));
+            overflow |= key >> (std::numeric_limits<std::uint64_t>::digits - shift);
+            keyed[pos] = (key << shift) | from;
+        }
+
+        if(overflow) {
+            // keys too wide to be packed, sort through the pool instead
+            reorder(std::move(compare), std::move(sort), Zip{});
+        } else {
+            keys(sort, keyed.data(), keyed.data() + sz, [](const std::uint64_t elem) { return key_type(elem >> shift); }, spare, 0);
+            indexes.resize(sz);
+
+            for(pos_type pos = 0; pos < sz; ++pos) {
+                indexes[sz - pos - 1] = pos_type(keyed[pos]);
+            }
+
+            permute();
+        }
+    }
+
+    void append(const Type *first, const Type *last, std::false_type) {
+        instances.insert(instances.end(), first, last);
+    }
+
+    void append(const Type *first, const Type *last, std::true_type) {
+        instances.reserve(underlying_type::size());
+        std::for_each(first, last, [this](const auto &value) { instances.emplace_back(value); });
+    }
+
+    void permute() {
+        for(typename underlying_type::pos_type pos = 0, last = indexes.size(); pos < last; ++pos) {
+            auto curr = pos;
+            auto next = indexes[curr];
+
+            while(curr != next) {
+                const auto lhs = indexes[curr];
+                const auto rhs = indexes[next];
+                using std::swap;
+                swap(instances[lhs], instances[rhs]);
+                underlying_type::swap(lhs, rhs);
+                indexes[curr] = curr;
+                curr = next;
+                next = indexes[curr];
+            }
+        }
+    }
+
 public:
     /*! @brief Type of the objects associated to the entities. */
     using object_type = Type;
@@ -565,9 +984,36 @@ public:
     using iterator_type = Iterator<false>;
     /*! @brief Constant input iterator type. */
     using const_iterator_type = Iterator<true>;
+    /*! @brief Type of pointer to the array of objects. */
+    using pointer_type = typename iterator_type::pointer;
+    /*! @brief Type of pointer to the array of constant objects. */
+    using const_pointer_type = typename const_iterator_type::pointer;
+    /*! @brief Type of reference to the objects. */
+    using reference_type = typename iterator_type::reference;
+    /*! @brief Type of reference to the constant objects. */
+    using const_reference_type = typename const_iterator_type::reference;
 
     /*! @brief Default constructor. */
-    SparseSet() ENTT_NOEXCEPT = default;
+    SparseSet() ENTT_NOEXCEPT
+        : SparseSet{default_resource()}
+    {}
+
+    /**
+     * @brief Constructs a sparse set that gets its memory from a resource.
+     *
+     * The objects, the entities and the temporary buffers used to sort them
+     * are all allocated from the given resource.
+     *
+     * @param resource A valid memory resource.
+     */
+    explicit SparseSet(MemoryResource *resource) ENTT_NOEXCEPT
+        : underlying_type{resource},
+          instances{Allocator<object_type>{resource}},
+          indexes{Allocator<pos_type>{resource}},
+          zipped{Allocator<Zipped>{resource}},
+          keyed{Allocator<std::uint64_t>{resource}},
+          spare{Allocator<std::uint64_t>{resource}}
+    {}
 
     /*! @brief Copying a sparse set isn't allowed. */
     SparseSet(const SparseSet &) = delete;
@@ -605,9 +1051,20 @@ public:
      * performance boost but less guarantees. Use `begin` and `end` if you want
      * to iterate the sparse set in the expected order.
      *
+     * @warning
+     * Objects of empty types aren't stored. In this case, the returned pointer
+     * refers to the only instance shared by all the entities and range
+     * `[raw(), raw() + size()]` isn't a valid range.<br/>
+     * Objects of types laid out as structure of arrays (see soa_traits) are
+     * returned through a proxy pointer. Use its member function `get` to access
+     * the array of a single data member.
+     *
+     * @note
+     * The array is aligned and padded as requested by storage_alignment.
+     *
      * @return A pointer to the array of objects.
      */
-    const object_type * raw() const ENTT_NOEXCEPT {
+    const_pointer_type raw() const ENTT_NOEXCEPT {
         return instances.data();
     }
 
@@ -624,9 +1081,20 @@ public:
      * performance boost but less guarantees. Use `begin` and `end` if you want
      * to iterate the sparse set in the expected order.
      *
+     * @warning
+     * Objects of empty types aren't stored. In this case, the returned pointer
+     * refers to the only instance shared by all the entities and range
+     * `[raw(), raw() + size()]` isn't a valid range.<br/>
+     * Objects of types laid out as structure of arrays (see soa_traits) are
+     * returned through a proxy pointer. Use its member function `get` to access
+     * the array of a single data member.
+     *
+     * @note
+     * The array is aligned and padded as requested by storage_alignment.
+     *
      * @return A pointer to the array of objects.
      */
-    object_type * raw() ENTT_NOEXCEPT {
+    pointer_type raw() ENTT_NOEXCEPT {
         return instances.data();
     }
 
@@ -643,7 +1111,7 @@ public:
      * @return An iterator to the first instance of the given type.
      */
     const_iterator_type cbegin() const ENTT_NOEXCEPT {
-        return const_iterator_type{instances.data(), instances.size()};
+        return const_iterator_type{instances.data(), underlying_type::size()};
     }
 
     /**
@@ -675,7 +1143,7 @@ public:
      * @return An iterator to the first instance of the given type.
      */
     iterator_type begin() ENTT_NOEXCEPT {
-        return iterator_type{instances.data(), instances.size()};
+        return iterator_type{instances.data(), underlying_type::size()};
     }
 
     /**
@@ -744,7 +1212,7 @@ public:
      * @param entity A valid entity identifier.
      * @return The object associated to the entity.
      */
-    const object_type & get(const entity_type entity) const ENTT_NOEXCEPT {
+    const_reference_type get(const entity_type entity) const ENTT_NOEXCEPT {
         return instances[underlying_type::get(entity)];
     }
 
@@ -760,8 +1228,26 @@ public:
      * @param entity A valid entity identifier.
      * @return The object associated to the entity.
      */
-    inline object_type & get(const entity_type entity) ENTT_NOEXCEPT {
-        return const_cast<object_type &>(const_cast<const SparseSet *>(this)->get(entity));
+    reference_type get(const entity_type entity) ENTT_NOEXCEPT {
+        return instances[underlying_type::get(entity)];
+    }
+
+    /**
+     * @brief Prefetches the object associated to an entity, if any.
+     *
+     * This is only a hint to move the object to the caches ahead of time, the
+     * sparse set isn't affected in any case. The slot of the entity in the
+     * sparse array is read to find the object, prefetch it with `prefetch`
+     * some time earlier to hide the latency of both the accesses.<br/>
+     * Nothing happens for objects of empty types or types laid out as
+     * structure of arrays.
+     *
+     * @param entity A valid entity identifier.
+     */
+    void prefetch_object(const entity_type entity) const ENTT_NOEXCEPT {
+        if(underlying_type::has(entity)) {
+            internal::prefetch(raw(), underlying_type::get(entity));
+        }
     }
 
     /**
@@ -785,7 +1271,7 @@ public:
      * @return The object associated to the entity.
      */
     template<typename... Args>
-    std::enable_if_t<std::is_constructible<Type, Args...>::value, object_type &>
+    std::enable_if_t<std::is_constructible<Type, Args...>::value, reference_type>
     construct(const entity_type entity, Args &&... args) {
         underlying_type::construct(entity);
         instances.emplace_back(std::forward<Args>(args)...);
@@ -813,13 +1299,85 @@ public:
      * @return The object associated to the entity.
      */
     template<typename... Args>
-    std::enable_if_t<!std::is_constructible<Type, Args...>::value, object_type &>
+    std::enable_if_t<!std::is_constructible<Type, Args...>::value, reference_type>
     construct(const entity_type entity, Args &&... args) {
         underlying_type::construct(entity);
         instances.emplace_back(Type{std::forward<Args>(args)...});
         return instances.back();
     }
 
+    /**
+     * @brief Assigns one or more entities to a sparse set and constructs their
+     * objects.
+     *
+     * The internal packed arrays are filled contiguously and memory is
+     * allocated at most once for the whole range of entities. Objects are
+     * copy-constructed from the given value.
+     *
+     * @note
+     * _Sfinae'd_ function.<br/>
+     * This version is used for iterators that aren't convertible to entity
+     * identifiers, so as not to clash with the overload for single entities.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the sparse set
+     * results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * sparse set already contains the given entity.
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value An object to copy to initialize the new instances.
+     * @return A pointer to the array of objects created for the given entities
+     * or to the shared instance in case of empty types.
+     */
+    template<typename It>
+    std::enable_if_t<!std::is_convertible<It, entity_type>::value, pointer_type>
+    construct(It first, It last, const object_type &value = {}) {
+        const auto sz = underlying_type::size();
+        underlying_type::construct(first, last);
+        instances.resize(underlying_type::size(), value);
+        return std::is_empty<object_type>::value ? instances.data() : (instances.data() + sz);
+    }
+
+    /**
+     * @brief Assigns one or more entities to a sparse set and copies their
+     * objects from an array.
+     *
+     * The internal packed arrays are filled contiguously and memory is
+     * allocated at most once for the whole range of entities. The object at
+     * position `i` in the array is given to the `i`-th entity of the range.
+     *
+     * @note
+     * _Sfinae'd_ function.<br/>
+     * This version is used for iterators that aren't convertible to entity
+     * identifiers, so as not to clash with the overload for single entities.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the sparse set
+     * results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * sparse set already contains the given entity.
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param values A pointer to an array of objects at least as long as the
+     * range of entities.
+     * @return A pointer to the array of objects created for the given entities
+     * or to the shared instance in case of empty types.
+     */
+    template<typename It>
+    std::enable_if_t<!std::is_convertible<It, entity_type>::value, pointer_type>
+    construct(It first, It last, const object_type *values) {
+        const auto sz = underlying_type::size();
+        underlying_type::construct(first, last);
+        // objects are copied in place, instances aren't default constructed first
+        append(values, values + (underlying_type::size() - sz), std::integral_constant<bool, internal::is_soa<object_type>::value || std::is_empty<object_type>::value>{});
+        return std::is_empty<object_type>::value ? instances.data() : (instances.data() + sz);
+    }
+
     /**
      * @brief Removes an entity from a sparse set and destroies its object.
      *
@@ -840,6 +1398,27 @@ public:
         underlying_type::destroy(entity);
     }
 
+    /**
+     * @brief Swaps the position of two entities and their objects.
+     *
+     * For what it's worth, this function affects both the internal sparse array
+     * and the internal packed arrays. Users should not care of that anyway.
+     *
+     * @warning
+     * Attempting to swap entities that don't belong to the sparse set results
+     * in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * sparse set doesn't contain the given entities.
+     *
+     * @param lhs A valid position within the sparse set.
+     * @param rhs A valid position within the sparse set.
+     */
+    void swap(const pos_type lhs, const pos_type rhs) ENTT_NOEXCEPT override {
+        using std::swap;
+        swap(instances[lhs], instances[rhs]);
+        underlying_type::swap(lhs, rhs);
+    }
+
     /**
      * @brief Sort components according to the given comparison function.
      *
@@ -869,6 +1448,24 @@ public:
      * necessarily the type of the one passed along with the other parameters to
      * this member function.
      *
+     * A unary function object that returns an unsigned integral key for the
+     * given element can be used in place of the comparison function. Elements
+     * are then sorted in ascending order of their keys and the key getter is
+     * passed to the sort function object in place of the comparison function
+     * (see RadixSort for more details). Keys are extracted once and sorted
+     * along with the positions of the elements, when they are narrow enough to
+     * share a word with them. Sort function objects that also accept a
+     * buffer of the same type as a fourth argument reuse the one kept by the
+     * sparse set.
+     *
+     * Small trivially copyable objects (see `ENTT_ZIP_SIZE`) are sorted along
+     * with their entities when a comparison function is provided, otherwise
+     * their positions are sorted. Objects laid out as structure of arrays (see
+     * soa_traits) are always sorted along with their entities. In all cases,
+     * the temporary buffer is kept and reused by later calls until the sparse
+     * set is reset.<br/>
+     * Sorting a sparse set of objects of an empty type does nothing.
+     *
      * @note
      * Attempting to iterate elements using a raw pointer returned by a call to
      * either `data` or `raw` gives no guarantees on the order, even though
@@ -881,26 +1478,15 @@ public:
      */
     template<typename Compare, typename Sort = StdSort>
     void sort(Compare compare, Sort sort = Sort{}) {
-        std::vector<pos_type> copy(instances.size());
-        std::iota(copy.begin(), copy.end(), 0);
+        // small trivially copyable objects are compared and moved along with their entities, with no indirection
+        using zip_type = std::integral_constant<bool, internal::is_soa<object_type>::value || (!decltype(unary<Compare>(0))::value && std::is_trivially_copyable<object_type>::value && (sizeof(object_type) <= ENTT_ZIP_SIZE))>;
 
-        sort(copy.begin(), copy.end(), [this, compare = std::move(compare)](const auto lhs, const auto rhs) {
-            return compare(const_cast<const object_type &>(instances[rhs]), const_cast<const object_type &>(instances[lhs]));
-        });
-
-        for(pos_type pos = 0, last = copy.size(); pos < last; ++pos) {
-            auto curr = pos;
-            auto next = copy[curr];
+        // keys are extracted once and sorted along with their positions, objects are moved only at the end
+        using keyed_type = std::integral_constant<bool, decltype(unary<Compare>(0))::value && !internal::is_soa<object_type>::value && (std::numeric_limits<pos_type>::digits < std::numeric_limits<std::uint64_t>::digits)>;
 
-            while(curr != next) {
-                const auto lhs = copy[curr];
-                const auto rhs = copy[next];
-                std::swap(instances[lhs], instances[rhs]);
-                underlying_type::swap(lhs, rhs);
-                copy[curr] = curr;
-                curr = next;
-                next = copy[curr];
-            }
+        // instances of empty types are indistinguishable, any order is already sorted
+        if(!std::is_empty<object_type>::value) {
+            reorder(std::move(compare), std::move(sort), zip_type{}, keyed_type{});
         }
     }
 
@@ -940,7 +1526,8 @@ public:
             if(underlying_type::has(curr)) {
                 if(curr != *(local + pos)) {
                     auto candidate = underlying_type::get(curr);
-                    std::swap(instances[pos], instances[candidate]);
+                    using std::swap;
+                    swap(instances[pos], instances[candidate]);
                     underlying_type::swap(pos, candidate);
                 }
 
@@ -957,10 +1544,22 @@ public:
     void reset() override {
         underlying_type::reset();
         instances.clear();
+        indexes.clear();
+        indexes.shrink_to_fit();
+        zipped.clear();
+        zipped.shrink_to_fit();
+        keyed.clear();
+        keyed.shrink_to_fit();
+        spare.clear();
+        spare.shrink_to_fit();
     }
 
 private:
-    std::vector<object_type> instances;
+    storage_type instances;
+    std::vector<pos_type, Allocator<pos_type>> indexes;
+    std::vector<Zipped, Allocator<Zipped>> zipped;
+    std::vector<std::uint64_t, Allocator<std::uint64_t>> keyed;
+    std::vector<std::uint64_t, Allocator<std::uint64_t>> spare;
 };
 
 
@@ -17,6 +17,18 @@ struct persistent_t final {};
 struct raw_t final {};
 
 
+/*! @brief Owning group type used to disambiguate overloads. */
+struct group_t final {};
+
+
+/**
+ * @brief Exclusion list type used to disambiguate overloads.
+ * @tparam Type List of types to exclude.
+ */
+template<typename... Type>
+struct exclude_t final {};
+
+
 /*! @brief Break type used to disambiguate overloads. */
 struct break_t final {};
 
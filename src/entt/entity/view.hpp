@@ -3,7 +3,9 @@
 
 
 #include <cassert>
+#include <iterator>
 #include <array>
+#include <vector>
 #include <tuple>
 #include <utility>
 #include <algorithm>
@@ -11,6 +13,7 @@
 #include "../config/config.h"
 #include "entt_traits.hpp"
 #include "sparse_set.hpp"
+#include "utility.hpp"
 
 
 namespace entt {
@@ -30,7 +33,10 @@ class Registry;
  * at least the given components. Moreover, it's guaranteed that the entity list
  * is tightly packed in memory for fast iterations.<br/>
  * In general, persistent views don't stay true to the order of any set of
- * components unless users explicitly sort them.
+ * components unless users explicitly sort them.<br/>
+ * Persistent views can also filter out the entities that have at least one of
+ * a given set of components. In this case, the entity list is kept up to date
+ * when excluded components are assigned or removed.
  *
  * @b Important
  *
@@ -60,13 +66,14 @@ class Registry;
  * @sa View
  * @sa View<Entity, Component>
  * @sa RawView
+ * @sa Group
  *
  * @tparam Entity A valid entity type (see entt_traits for more details).
  * @tparam Component Types of components iterated by the view.
  */
 template<typename Entity, typename... Component>
 class PersistentView final {
-    static_assert(sizeof...(Component) > 1, "!");
+    static_assert(sizeof...(Component) > 0, "!");
 
     /*! @brief A registry is allowed to create views. */
     friend class Registry<Entity>;
@@ -261,7 +268,7 @@ public:
      * @return The component assigned to the entity.
      */
     template<typename Comp>
-    const Comp & get(const entity_type entity) const ENTT_NOEXCEPT {
+    typename pool_type<Comp>::const_reference_type get(const entity_type entity) const ENTT_NOEXCEPT {
         assert(contains(entity));
         return std::get<pool_type<Comp> &>(pools).get(entity);
     }
@@ -284,8 +291,8 @@ public:
      * @return The component assigned to the entity.
      */
     template<typename Comp>
-    inline Comp & get(const entity_type entity) ENTT_NOEXCEPT {
-        return const_cast<Comp &>(const_cast<const PersistentView *>(this)->get<Comp>(entity));
+    inline typename pool_type<Comp>::reference_type get(const entity_type entity) ENTT_NOEXCEPT {
+        return internal::unconst(const_cast<const PersistentView *>(this)->get<Comp>(entity));
     }
 
     /**
@@ -306,10 +313,10 @@ public:
      * @return The components assigned to the entity.
      */
     template<typename... Comp>
-    inline std::enable_if_t<(sizeof...(Comp) > 1), std::tuple<const Comp &...>>
+    inline std::enable_if_t<(sizeof...(Comp) > 1), std::tuple<typename pool_type<Comp>::const_reference_type...>>
     get(const entity_type entity) const ENTT_NOEXCEPT {
         assert(contains(entity));
-        return std::tuple<const Comp &...>{get<Comp>(entity)...};
+        return std::tuple<typename pool_type<Comp>::const_reference_type...>{get<Comp>(entity)...};
     }
 
     /**
@@ -330,10 +337,10 @@ public:
      * @return The components assigned to the entity.
      */
     template<typename... Comp>
-    inline std::enable_if_t<(sizeof...(Comp) > 1), std::tuple<Comp &...>>
+    inline std::enable_if_t<(sizeof...(Comp) > 1), std::tuple<typename pool_type<Comp>::reference_type...>>
     get(const entity_type entity) ENTT_NOEXCEPT {
         assert(contains(entity));
-        return std::tuple<Comp &...>{get<Comp>(entity)...};
+        return std::tuple<typename pool_type<Comp>::reference_type...>{get<Comp>(entity)...};
     }
 
     /**
@@ -377,8 +384,74 @@ public:
      */
     template<typename Func>
     inline void each(Func func) {
-        const_cast<const PersistentView *>(this)->each([&func](const entity_type entity, const Component &... component) {
-            func(entity, const_cast<Component &>(component)...);
+        const_cast<const PersistentView *>(this)->each([&func](const entity_type entity, auto &&... component) {
+            func(entity, internal::unconst(component)...);
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components in parallel and applies the given
+     * function object to them.
+     *
+     * Entities are split in chunks of `ENTT_CHUNK_SIZE` elements and each chunk
+     * is a job for the given executor (see ThreadPool for more details about
+     * executors). The function object is invoked for each entity. It is
+     * provided with the entity itself and a set of const references to all the
+     * components of the view.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, const Component &...);
+     * @endcode
+     *
+     * @sa ThreadPool
+     *
+     * @tparam Executor Type of executor to use to run the jobs.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Executor, typename Func>
+    void par_each(Executor &&executor, Func func) const {
+        const auto *entities = view.data();
+        const auto sz = view.size();
+
+        executor((sz + ENTT_CHUNK_SIZE - 1) / ENTT_CHUNK_SIZE, [&func, entities, sz, this](const size_type chunk) {
+            const auto last = std::min(sz, (chunk + 1) * ENTT_CHUNK_SIZE);
+
+            for(auto pos = chunk * ENTT_CHUNK_SIZE; pos < last; ++pos) {
+                const auto entity = entities[pos];
+                func(entity, std::get<pool_type<Component> &>(pools).get(entity)...);
+            }
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components in parallel and applies the given
+     * function object to them.
+     *
+     * Entities are split in chunks of `ENTT_CHUNK_SIZE` elements and each chunk
+     * is a job for the given executor (see ThreadPool for more details about
+     * executors). The function object is invoked for each entity. It is
+     * provided with the entity itself and a set of references to all the
+     * components of the view.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &...);
+     * @endcode
+     *
+     * @sa ThreadPool
+     *
+     * @tparam Executor Type of executor to use to run the jobs.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Executor, typename Func>
+    inline void par_each(Executor &&executor, Func func) {
+        const_cast<const PersistentView *>(this)->par_each(std::forward<Executor>(executor), [&func](const entity_type entity, auto &&... component) {
+            func(entity, internal::unconst(component)...);
         });
     }
 
@@ -410,16 +483,18 @@ private:
 
 
 /**
- * @brief Multi component view.
+ * @brief Owning group.
  *
- * Multi component views iterate over those entities that have at least all the
- * given components in their bags. During initialization, a multi component view
- * looks at the number of entities available for each component and picks up a
- * reference to the smallest set of candidate entities in order to get a
- * performance boost when iterate.<br/>
- * Order of elements during iterations are highly dependent on the order of the
- * underlying data structures. See SparseSet and its specializations for more
- * details.
+ * An owning group returns all the entities and only the entities that have at
+ * least the given components. The registry keeps these entities packed at the
+ * beginning of the pools of the components in the same order. Therefore, the
+ * entities and the components of a group are laid out in parallel arrays and
+ * iterating them doesn't require any indirection at all.<br/>
+ * On the other side, the pools of the given components are _owned_ by the
+ * group and they cannot be sorted nor owned by other groups. For the same
+ * reason, assigning one of these components to a range of entities doesn't
+ * return a pointer to the instances created, since they aren't contiguous
+ * anymore once the entities joined the group.
  *
  * @b Important
  *
@@ -434,203 +509,114 @@ private:
  * behavior.
  *
  * @note
- * Views share references to the underlying data structures with the Registry
+ * Groups share references to the underlying data structures with the Registry
  * that generated them. Therefore any change to the entities and to the
- * components made by means of the registry are immediately reflected by views.
+ * components made by means of the registry are immediately reflected by
+ * groups.
  *
  * @warning
- * Lifetime of a view must overcome the one of the registry that generated it.
- * In any other case, attempting to use a view results in undefined behavior.
+ * Lifetime of a group must overcome the one of the registry that generated it.
+ * In any other case, attempting to use a group results in undefined behavior.
  *
+ * @sa View
  * @sa View<Entity, Component>
  * @sa PersistentView
  * @sa RawView
  *
  * @tparam Entity A valid entity type (see entt_traits for more details).
- * @tparam Component Types of components iterated by the view.
+ * @tparam Component Types of components owned by the group.
  */
 template<typename Entity, typename... Component>
-class View final {
+class Group final {
     static_assert(sizeof...(Component) > 1, "!");
 
-    /*! @brief A registry is allowed to create views. */
+    /*! @brief A registry is allowed to create groups. */
     friend class Registry<Entity>;
 
     template<typename Comp>
     using pool_type = SparseSet<Entity, Comp>;
 
-    template<typename Comp>
-    using component_iterator_type = typename pool_type<Comp>::const_iterator_type;
-
     using view_type = SparseSet<Entity>;
-    using underlying_iterator_type = typename view_type::const_iterator_type;
-    using unchecked_type = std::array<const view_type *, (sizeof...(Component) - 1)>;
     using pattern_type = std::tuple<pool_type<Component> &...>;
-    using traits_type = entt_traits<Entity>;
-
-    class Iterator {
-        using size_type = typename view_type::size_type;
-
-        bool valid() const ENTT_NOEXCEPT {
-            const auto entity = *begin;
-            const auto sz = size_type(entity & traits_type::entity_mask);
-
-            return sz < extent && std::all_of(unchecked.cbegin(), unchecked.cend(), [entity](const view_type *view) {
-                return view->fast(entity);
-            });
-        }
-
-    public:
-        using difference_type = typename underlying_iterator_type::difference_type;
-        using value_type = typename underlying_iterator_type::value_type;
-        using pointer = typename underlying_iterator_type::pointer;
-        using reference = typename underlying_iterator_type::reference;
-        using iterator_category = typename underlying_iterator_type::iterator_category;
-
-        Iterator(unchecked_type unchecked, size_type extent, underlying_iterator_type begin, underlying_iterator_type end) ENTT_NOEXCEPT
-            : unchecked{unchecked},
-              extent{extent},
-              begin{begin},
-              end{end}
-        {
-            if(begin != end && !valid()) {
-                ++(*this);
-            }
-        }
-
-        Iterator & operator++() ENTT_NOEXCEPT {
-            return (++begin != end && !valid()) ? ++(*this) : *this;
-        }
-
-        Iterator operator++(int) ENTT_NOEXCEPT {
-            Iterator orig = *this;
-            return ++(*this), orig;
-        }
-
-        Iterator & operator+=(const difference_type value) ENTT_NOEXCEPT {
-            return ((begin += value) != end && !valid()) ? ++(*this) : *this;
-        }
-
-        Iterator operator+(const difference_type value) const ENTT_NOEXCEPT {
-            return Iterator{unchecked, extent, begin+value, end};
-        }
-
-        bool operator==(const Iterator &other) const ENTT_NOEXCEPT {
-            return other.begin == begin;
-        }
-
-        inline bool operator!=(const Iterator &other) const ENTT_NOEXCEPT {
-            return !(*this == other);
-        }
-
-        value_type operator*() const ENTT_NOEXCEPT {
-            return *begin;
-        }
-
-    private:
-        const unchecked_type unchecked;
-        const size_type extent;
-        underlying_iterator_type begin;
-        underlying_iterator_type end;
-    };
 
-    View(pool_type<Component> &... pools) ENTT_NOEXCEPT
-        : pools{pools...}
+    Group(const typename view_type::size_type &length, pool_type<Component> &... pools) ENTT_NOEXCEPT
+        : length{length}, pools{pools...}
     {}
 
-    template<typename Comp>
-    const pool_type<Comp> & pool() const ENTT_NOEXCEPT {
-        return std::get<pool_type<Comp> &>(pools);
-    }
-
-    template<typename Comp>
-    inline pool_type<Comp> & pool() ENTT_NOEXCEPT {
-        return const_cast<pool_type<Comp> &>(const_cast<const View *>(this)->pool<Comp>());
-    }
-
-    const view_type * candidate() const ENTT_NOEXCEPT {
-        return std::min({ static_cast<const view_type *>(&pool<Component>())... }, [](const auto *lhs, const auto *rhs) {
-            return lhs->size() < rhs->size();
-        });
-    }
-
-    unchecked_type unchecked(const view_type *view) const ENTT_NOEXCEPT {
-        unchecked_type other{};
-        std::size_t pos{};
-        using accumulator_type = const view_type *[];
-        accumulator_type accumulator = { (&pool<Component>() == view ? view : other[pos++] = &pool<Component>())... };
-        (void)accumulator;
-        return other;
-    }
-
-    typename view_type::size_type extent() const ENTT_NOEXCEPT {
-        return std::min({ pool<Component>().extent()... });
-    }
-
-    template<typename Comp, typename Other>
-    inline std::enable_if_t<std::is_same<Comp, Other>::value, const Other &>
-    get(const component_iterator_type<Comp> &it, const Entity) const ENTT_NOEXCEPT { return *it; }
-
-    template<typename Comp, typename Other>
-    inline std::enable_if_t<!std::is_same<Comp, Other>::value, const Other &>
-    get(const component_iterator_type<Comp> &, const Entity entity) const ENTT_NOEXCEPT { return pool<Other>().get(entity); }
-
-    template<typename Comp, typename Func, std::size_t... Indexes>
-    void each(const pool_type<Comp> &cpool, Func func, std::index_sequence<Indexes...>) const {
-        const auto other = unchecked(&cpool);
-        std::array<underlying_iterator_type, sizeof...(Component)> data{{cpool.view_type::cbegin(), std::get<Indexes>(other)->cbegin()...}};
-        auto raw = std::make_tuple(pool<Component>().cbegin()...);
-        const auto end = cpool.view_type::cend();
-        std::size_t pos{};
-
-        // we can directly use the raw iterators if pools are ordered
-        while(!pos && data[0] != end) {
-            for(pos = data.size() - 1; pos && *(data[pos]++) == *data[pos-1]; --pos);
-
-            if(!pos) {
-                func(*(data[0]++), *(std::get<component_iterator_type<Component>>(raw)++)...);
-            }
-        }
-
-        auto it = std::get<component_iterator_type<Comp>>(raw);
-        const auto ext = extent();
-
-        // fallback to visit what remains using indirections
-        for(; data[0] != end; ++data[0], ++it) {
-            const auto entity = *data[0];
-            const auto sz = size_type(entity & traits_type::entity_mask);
-
-            if(sz < ext && std::all_of(other.cbegin(), other.cend(), [entity](const view_type *view) { return view->fast(entity); })) {
-                // avoided at least the indirection due to the sparse set for the pivot type (see get for more details)
-                func(entity, get<Comp, Component>(it, entity)...);
-            }
-        }
+    inline const view_type & view() const ENTT_NOEXCEPT {
+        return std::get<0>(pools);
     }
 
 public:
     /*! @brief Input iterator type. */
-    using iterator_type = Iterator;
+    using iterator_type = typename view_type::iterator_type;
     /*! @brief Constant input iterator type. */
-    using const_iterator_type = Iterator;
+    using const_iterator_type = typename view_type::const_iterator_type;
     /*! @brief Underlying entity identifier. */
     using entity_type = typename view_type::entity_type;
     /*! @brief Unsigned integer type. */
     using size_type = typename view_type::size_type;
 
     /**
-     * @brief Estimates the number of entities that have the given components.
-     * @return Estimated number of entities that have the given components.
+     * @brief Returns the number of entities that have the given components.
+     * @return Number of entities that have the given components.
      */
     size_type size() const ENTT_NOEXCEPT {
-        return std::min({ pool<Component>().size()... });
+        return length;
     }
 
     /**
-     * @brief Checks if the view is definitely empty.
-     * @return True if the view is definitely empty, false otherwise.
+     * @brief Checks whether the group is empty.
+     * @return True if the group is empty, false otherwise.
      */
     bool empty() const ENTT_NOEXCEPT {
-        return std::max({ pool<Component>().empty()... });
+        return !length;
+    }
+
+    /**
+     * @brief Direct access to the list of entities.
+     *
+     * The returned pointer is such that range `[data(), data() + size()]` is
+     * always a valid range, even if the container is empty.
+     *
+     * @note
+     * There are no guarantees on the order of the entities. Use `begin` and
+     * `end` if you want to iterate the group in the expected order.
+     *
+     * @return A pointer to the array of entities.
+     */
+    const entity_type * data() const ENTT_NOEXCEPT {
+        return view().data();
+    }
+
+    /**
+     * @brief Direct access to the list of components of a given type.
+     *
+     * The returned pointer is such that range `[raw<Comp>(), raw<Comp>() +
+     * size()]` is always a valid range, even if the container is empty.<br/>
+     * Components are in the same order of the entities returned by `data`.
+     *
+     * @tparam Comp Type of component in which one is interested.
+     * @return A pointer to the array of components.
+     */
+    template<typename Comp>
+    typename pool_type<Comp>::const_pointer_type raw() const ENTT_NOEXCEPT {
+        return std::get<pool_type<Comp> &>(pools).raw();
+    }
+
+    /**
+     * @brief Direct access to the list of components of a given type.
+     *
+     * The returned pointer is such that range `[raw<Comp>(), raw<Comp>() +
+     * size()]` is always a valid range, even if the container is empty.<br/>
+     * Components are in the same order of the entities returned by `data`.
+     *
+     * @tparam Comp Type of component in which one is interested.
+     * @return A pointer to the array of components.
+     */
+    template<typename Comp>
+    typename pool_type<Comp>::pointer_type raw() ENTT_NOEXCEPT {
+        return std::get<pool_type<Comp> &>(pools).raw();
     }
 
     /**
@@ -638,18 +624,13 @@ public:
      * components.
      *
      * The returned iterator points to the first entity that has the given
-     * components. If the view is empty, the returned iterator will be equal to
+     * components. If the group is empty, the returned iterator will be equal to
      * `end()`.
      *
-     * @note
-     * Input iterators stay true to the order imposed to the underlying data
-     * structures.
-     *
      * @return An iterator to the first entity that has the given components.
      */
     const_iterator_type cbegin() const ENTT_NOEXCEPT {
-        const auto *view = candidate();
-        return iterator_type{ unchecked(view), extent(), view->cbegin(), view->cend() };
+        return const_iterator_type{view().data(), length};
     }
 
     /**
@@ -657,13 +638,9 @@ public:
      * components.
      *
      * The returned iterator points to the first entity that has the given
-     * components. If the view is empty, the returned iterator will be equal to
+     * components. If the group is empty, the returned iterator will be equal to
      * `end()`.
      *
-     * @note
-     * Input iterators stay true to the order imposed to the underlying data
-     * structures.
-     *
      * @return An iterator to the first entity that has the given components.
      */
     inline const_iterator_type begin() const ENTT_NOEXCEPT {
@@ -675,13 +652,9 @@ public:
      * components.
      *
      * The returned iterator points to the first entity that has the given
-     * components. If the view is empty, the returned iterator will be equal to
+     * components. If the group is empty, the returned iterator will be equal to
      * `end()`.
      *
-     * @note
-     * Input iterators stay true to the order imposed to the underlying data
-     * structures.
-     *
      * @return An iterator to the first entity that has the given components.
      */
     inline iterator_type begin() ENTT_NOEXCEPT {
@@ -696,16 +669,11 @@ public:
      * has the given components. Attempting to dereference the returned iterator
      * results in undefined behavior.
      *
-     * @note
-     * Input iterators stay true to the order imposed to the underlying data
-     * structures.
-     *
      * @return An iterator to the entity following the last entity that has the
      * given components.
      */
     const_iterator_type cend() const ENTT_NOEXCEPT {
-        const auto *view = candidate();
-        return iterator_type{ unchecked(view), extent(), view->cend(), view->cend() };
+        return const_iterator_type{view().data(), {}};
     }
 
     /**
@@ -716,10 +684,6 @@ public:
      * has the given components. Attempting to dereference the returned iterator
      * results in undefined behavior.
      *
-     * @note
-     * Input iterators stay true to the order imposed to the underlying data
-     * structures.
-     *
      * @return An iterator to the entity following the last entity that has the
      * given components.
      */
@@ -735,10 +699,6 @@ public:
      * has the given components. Attempting to dereference the returned iterator
      * results in undefined behavior.
      *
-     * @note
-     * Input iterators stay true to the order imposed to the underlying data
-     * structures.
-     *
      * @return An iterator to the entity following the last entity that has the
      * given components.
      */
@@ -747,13 +707,12 @@ public:
     }
 
     /**
-     * @brief Checks if a view contains an entity.
+     * @brief Checks if a group contains an entity.
      * @param entity A valid entity identifier.
-     * @return True if the view contains the given entity, false otherwise.
+     * @return True if the group contains the given entity, false otherwise.
      */
     bool contains(const entity_type entity) const ENTT_NOEXCEPT {
-        const auto sz = size_type(entity & traits_type::entity_mask);
-        return sz < extent() && std::min({ (pool<Component>().has(entity) && (pool<Component>().data()[pool<Component>().view_type::get(entity)] == entity))... });
+        return view().has(entity) && (view().get(entity) < length) && (view().data()[view().get(entity)] == entity);
     }
 
     /**
@@ -764,19 +723,19 @@ public:
      *
      * @warning
      * Attempting to use an invalid component type results in a compilation
-     * error. Attempting to use an entity that doesn't belong to the view
+     * error. Attempting to use an entity that doesn't belong to the group
      * results in undefined behavior.<br/>
      * An assertion will abort the execution at runtime in debug mode if the
-     * view doesn't contain the given entity.
+     * group doesn't contain the given entity.
      *
      * @tparam Comp Type of component to get.
      * @param entity A valid entity identifier.
      * @return The component assigned to the entity.
      */
     template<typename Comp>
-    const Comp & get(const entity_type entity) const ENTT_NOEXCEPT {
+    typename pool_type<Comp>::const_reference_type get(const entity_type entity) const ENTT_NOEXCEPT {
         assert(contains(entity));
-        return pool<Comp>().get(entity);
+        return std::get<pool_type<Comp> &>(pools).get(entity);
     }
 
     /**
@@ -787,18 +746,18 @@ public:
      *
      * @warning
      * Attempting to use an invalid component type results in a compilation
-     * error. Attempting to use an entity that doesn't belong to the view
+     * error. Attempting to use an entity that doesn't belong to the group
      * results in undefined behavior.<br/>
      * An assertion will abort the execution at runtime in debug mode if the
-     * view doesn't contain the given entity.
+     * group doesn't contain the given entity.
      *
      * @tparam Comp Type of component to get.
      * @param entity A valid entity identifier.
      * @return The component assigned to the entity.
      */
     template<typename Comp>
-    inline Comp & get(const entity_type entity) ENTT_NOEXCEPT {
-        return const_cast<Comp &>(const_cast<const View *>(this)->get<Comp>(entity));
+    inline typename pool_type<Comp>::reference_type get(const entity_type entity) ENTT_NOEXCEPT {
+        return internal::unconst(const_cast<const Group *>(this)->get<Comp>(entity));
     }
 
     /**
@@ -809,20 +768,20 @@ public:
      *
      * @warning
      * Attempting to use invalid component types results in a compilation error.
-     * Attempting to use an entity that doesn't belong to the view results in
+     * Attempting to use an entity that doesn't belong to the group results in
      * undefined behavior.<br/>
      * An assertion will abort the execution at runtime in debug mode if the
-     * view doesn't contain the given entity.
+     * group doesn't contain the given entity.
      *
      * @tparam Comp Types of the components to get.
      * @param entity A valid entity identifier.
      * @return The components assigned to the entity.
      */
     template<typename... Comp>
-    inline std::enable_if_t<(sizeof...(Comp) > 1), std::tuple<const Comp &...>>
+    inline std::enable_if_t<(sizeof...(Comp) > 1), std::tuple<typename pool_type<Comp>::const_reference_type...>>
     get(const entity_type entity) const ENTT_NOEXCEPT {
         assert(contains(entity));
-        return std::tuple<const Comp &...>{get<Comp>(entity)...};
+        return std::tuple<typename pool_type<Comp>::const_reference_type...>{get<Comp>(entity)...};
     }
 
     /**
@@ -833,20 +792,20 @@ public:
      *
      * @warning
      * Attempting to use invalid component types results in a compilation error.
-     * Attempting to use an entity that doesn't belong to the view results in
+     * Attempting to use an entity that doesn't belong to the group results in
      * undefined behavior.<br/>
      * An assertion will abort the execution at runtime in debug mode if the
-     * view doesn't contain the given entity.
+     * group doesn't contain the given entity.
      *
      * @tparam Comp Types of the components to get.
      * @param entity A valid entity identifier.
      * @return The components assigned to the entity.
      */
     template<typename... Comp>
-    inline std::enable_if_t<(sizeof...(Comp) > 1), std::tuple<Comp &...>>
+    inline std::enable_if_t<(sizeof...(Comp) > 1), std::tuple<typename pool_type<Comp>::reference_type...>>
     get(const entity_type entity) ENTT_NOEXCEPT {
         assert(contains(entity));
-        return std::tuple<Comp &...>{get<Comp>(entity)...};
+        return std::tuple<typename pool_type<Comp>::reference_type...>{get<Comp>(entity)...};
     }
 
     /**
@@ -855,7 +814,8 @@ public:
      *
      * The function object is invoked for each entity. It is provided with the
      * entity itself and a set of const references to all the components of the
-     * view.<br/>
+     * group. No indirections are involved, entities and components are visited
+     * linearly.<br/>
      * The signature of the function should be equivalent to the following:
      *
      * @code{.cpp}
@@ -867,10 +827,12 @@ public:
      */
     template<typename Func>
     void each(Func func) const {
-        const auto *view = candidate();
-        using accumulator_type = int[];
-        accumulator_type accumulator = { (&pool<Component>() == view ? (each(pool<Component>(), std::move(func), std::make_index_sequence<sizeof...(Component)-1>{}), 0) : 0)... };
-        (void)accumulator;
+        const auto *entities = view().data();
+        const auto raws = std::make_tuple(raw<Component>()...);
+
+        for(auto pos = length; pos; --pos) {
+            func(entities[pos-1], internal::element(std::get<typename pool_type<Component>::const_pointer_type>(raws), pos-1)...);
+        }
     }
 
     /**
@@ -879,7 +841,8 @@ public:
      *
      * The function object is invoked for each entity. It is provided with the
      * entity itself and a set of references to all the components of the
-     * view.<br/>
+     * group. No indirections are involved, entities and components are visited
+     * linearly.<br/>
      * The signature of the function should be equivalent to the following:
      *
      * @code{.cpp}
@@ -891,39 +854,109 @@ public:
      */
     template<typename Func>
     inline void each(Func func) {
-        const_cast<const View *>(this)->each([&func](const entity_type entity, const Component &... component) {
-            func(entity, const_cast<Component &>(component)...);
+        const_cast<const Group *>(this)->each([&func](const entity_type entity, auto &&... component) {
+            func(entity, internal::unconst(component)...);
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components in parallel and applies the given
+     * function object to them.
+     *
+     * Entities are split in chunks of `ENTT_CHUNK_SIZE` elements and each chunk
+     * is a job for the given executor (see ThreadPool for more details about
+     * executors). The function object is invoked for each entity. It is
+     * provided with the entity itself and a set of const references to all the
+     * components of the group.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, const Component &...);
+     * @endcode
+     *
+     * @sa ThreadPool
+     *
+     * @tparam Executor Type of executor to use to run the jobs.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Executor, typename Func>
+    void par_each(Executor &&executor, Func func) const {
+        const auto *entities = view().data();
+        const auto raws = std::make_tuple(raw<Component>()...);
+        const auto sz = size_type{length};
+
+        executor((sz + ENTT_CHUNK_SIZE - 1) / ENTT_CHUNK_SIZE, [&func, &raws, entities, sz](const size_type chunk) {
+            const auto last = std::min(sz, (chunk + 1) * ENTT_CHUNK_SIZE);
+
+            for(auto pos = chunk * ENTT_CHUNK_SIZE; pos < last; ++pos) {
+                func(entities[pos], internal::element(std::get<typename pool_type<Component>::const_pointer_type>(raws), pos)...);
+            }
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components in parallel and applies the given
+     * function object to them.
+     *
+     * Entities are split in chunks of `ENTT_CHUNK_SIZE` elements and each chunk
+     * is a job for the given executor (see ThreadPool for more details about
+     * executors). The function object is invoked for each entity. It is
+     * provided with the entity itself and a set of references to all the
+     * components of the group.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &...);
+     * @endcode
+     *
+     * @sa ThreadPool
+     *
+     * @tparam Executor Type of executor to use to run the jobs.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Executor, typename Func>
+    inline void par_each(Executor &&executor, Func func) {
+        const_cast<const Group *>(this)->par_each(std::forward<Executor>(executor), [&func](const entity_type entity, auto &&... component) {
+            func(entity, internal::unconst(component)...);
         });
     }
 
 private:
+    const typename view_type::size_type &length;
     const pattern_type pools;
 };
 
 
 /**
- * @brief Single component view specialization.
+ * @brief Multi component view.
  *
- * Single component views are specialized in order to get a boost in terms of
- * performance. This kind of views can access the underlying data structure
- * directly and avoid superfluous checks.<br/>
+ * Multi component views iterate over those entities that have at least all the
+ * given components in their bags. During initialization, a multi component view
+ * looks at the number of entities available for each component and picks up a
+ * reference to the smallest set of candidate entities in order to get a
+ * performance boost when iterate.<br/>
  * Order of elements during iterations are highly dependent on the order of the
- * underlying data structure. See SparseSet and its specializations for more
+ * underlying data structures. See SparseSet and its specializations for more
  * details.
  *
  * @b Important
  *
  * Iterators aren't invalidated if:
  *
- * * New instances of the given component are created and assigned to entities.
- * * The entity currently pointed is modified (as an example, the given
- *   component is removed from the entity to which the iterator points).
+ * * New instances of the given components are created and assigned to entities.
+ * * The entity currently pointed is modified (as an example, if one of the
+ *   given components is removed from the entity to which the iterator points).
  *
- * In all the other cases, modifying the pool of the given component in any way
- * invalidates all the iterators and using them results in undefined behavior.
+ * In all the other cases, modifying the pools of the given components in any
+ * way invalidates all the iterators and using them results in undefined
+ * behavior.
  *
  * @note
- * Views share a reference to the underlying data structure with the Registry
+ * Views share references to the underlying data structures with the Registry
  * that generated them. Therefore any change to the entities and to the
  * components made by means of the registry are immediately reflected by views.
  *
@@ -931,132 +964,261 @@ private:
  * Lifetime of a view must overcome the one of the registry that generated it.
  * In any other case, attempting to use a view results in undefined behavior.
  *
- * @sa View
+ * @sa View<Entity, Component>
  * @sa PersistentView
  * @sa RawView
  *
  * @tparam Entity A valid entity type (see entt_traits for more details).
- * @tparam Component Type of component iterated by the view.
+ * @tparam Component Types of components iterated by the view.
  */
-template<typename Entity, typename Component>
-class View<Entity, Component> final {
+template<typename Entity, typename... Component>
+class View final {
+    static_assert(sizeof...(Component) > 1, "!");
+
     /*! @brief A registry is allowed to create views. */
     friend class Registry<Entity>;
 
+    template<typename Comp>
+    using pool_type = SparseSet<Entity, Comp>;
+
+    template<typename Comp>
+    using component_iterator_type = typename pool_type<Comp>::const_iterator_type;
+
     using view_type = SparseSet<Entity>;
-    using pool_type = SparseSet<Entity, Component>;
+    using underlying_iterator_type = typename view_type::const_iterator_type;
+    using unchecked_type = std::array<const view_type *, (sizeof...(Component) - 1)>;
+    using pattern_type = std::tuple<pool_type<Component> &...>;
+    using traits_type = entt_traits<Entity>;
 
-    View(pool_type &pool) ENTT_NOEXCEPT
-        : pool{pool}
-    {}
+    class Iterator {
+        using size_type = typename view_type::size_type;
 
-public:
-    /*! @brief Input iterator type. */
-    using iterator_type = typename view_type::iterator_type;
-    /*! @brief Constant input iterator type. */
-    using const_iterator_type = typename view_type::const_iterator_type;
-    /*! @brief Underlying entity identifier. */
-    using entity_type = typename pool_type::entity_type;
-    /*! @brief Unsigned integer type. */
-    using size_type = typename pool_type::size_type;
-    /*! @brief Type of component iterated by the view. */
-    using raw_type = typename pool_type::object_type;
+        bool valid() const ENTT_NOEXCEPT {
+            const auto entity = *begin;
+            const auto sz = size_type(entity & traits_type::entity_mask);
 
-    /**
-     * @brief Returns the number of entities that have the given component.
-     * @return Number of entities that have the given component.
-     */
-    size_type size() const ENTT_NOEXCEPT {
-        return pool.size();
-    }
+            return sz < extent && std::all_of(unchecked.cbegin(), unchecked.cend(), [entity](const view_type *view) {
+                return view->fast(entity);
+            });
+        }
 
-    /**
-     * @brief Checks whether the view is empty.
-     * @return True if the view is empty, false otherwise.
-     */
-    bool empty() const ENTT_NOEXCEPT {
-        return pool.empty();
+    public:
+        using difference_type = typename underlying_iterator_type::difference_type;
+        using value_type = typename underlying_iterator_type::value_type;
+        using pointer = typename underlying_iterator_type::pointer;
+        using reference = typename underlying_iterator_type::reference;
+        using iterator_category = typename underlying_iterator_type::iterator_category;
+
+        Iterator(unchecked_type unchecked, size_type extent, underlying_iterator_type begin, underlying_iterator_type end) ENTT_NOEXCEPT
+            : unchecked{unchecked},
+              extent{extent},
+              begin{begin},
+              end{end}
+        {
+            if(begin != end && !valid()) {
+                ++(*this);
+            }
+        }
+
+        Iterator & operator++() ENTT_NOEXCEPT {
+            return (++begin != end && !valid()) ? ++(*this) : *this;
+        }
+
+        Iterator operator++(int) ENTT_NOEXCEPT {
+            Iterator orig = *this;
+            return ++(*this), orig;
+        }
+
+        Iterator & operator+=(const difference_type value) ENTT_NOEXCEPT {
+            return ((begin += value) != end && !valid()) ? ++(*this) : *this;
+        }
+
+        Iterator operator+(const difference_type value) const ENTT_NOEXCEPT {
+            return Iterator{unchecked, extent, begin+value, end};
+        }
+
+        bool operator==(const Iterator &other) const ENTT_NOEXCEPT {
+            return other.begin == begin;
+        }
+
+        inline bool operator!=(const Iterator &other) const ENTT_NOEXCEPT {
+            return !(*this == other);
+        }
+
+        value_type operator*() const ENTT_NOEXCEPT {
+            return *begin;
+        }
+
+    private:
+        const unchecked_type unchecked;
+        const size_type extent;
+        underlying_iterator_type begin;
+        underlying_iterator_type end;
+    };
+
+    View(pool_type<Component> &... pools) ENTT_NOEXCEPT
+        : pools{pools...}
+    {}
+
+    template<typename Comp>
+    const pool_type<Comp> & pool() const ENTT_NOEXCEPT {
+        return std::get<pool_type<Comp> &>(pools);
     }
 
-    /**
-     * @brief Direct access to the list of components.
-     *
-     * The returned pointer is such that range `[raw(), raw() + size()]` is
-     * always a valid range, even if the container is empty.
-     *
-     * @note
-     * There are no guarantees on the order of the components. Use `begin` and
-     * `end` if you want to iterate the view in the expected order.
-     *
-     * @return A pointer to the array of components.
-     */
-    const raw_type * raw() const ENTT_NOEXCEPT {
-        return pool.raw();
+    template<typename Comp>
+    inline pool_type<Comp> & pool() ENTT_NOEXCEPT {
+        return const_cast<pool_type<Comp> &>(const_cast<const View *>(this)->pool<Comp>());
     }
 
-    /**
-     * @brief Direct access to the list of components.
-     *
-     * The returned pointer is such that range `[raw(), raw() + size()]` is
-     * always a valid range, even if the container is empty.
-     *
-     * @note
-     * There are no guarantees on the order of the components. Use `begin` and
-     * `end` if you want to iterate the view in the expected order.
-     *
-     * @return A pointer to the array of components.
-     */
-    inline raw_type * raw() ENTT_NOEXCEPT {
-        return const_cast<raw_type *>(const_cast<const View *>(this)->raw());
+    const view_type * candidate() const ENTT_NOEXCEPT {
+        return std::min({ static_cast<const view_type *>(&pool<Component>())... }, [](const auto *lhs, const auto *rhs) {
+            return lhs->size() < rhs->size();
+        });
     }
 
-    /**
-     * @brief Direct access to the list of entities.
-     *
-     * The returned pointer is such that range `[data(), data() + size()]` is
-     * always a valid range, even if the container is empty.
-     *
-     * @note
-     * There are no guarantees on the order of the entities. Use `begin` and
-     * `end` if you want to iterate the view in the expected order.
-     *
-     * @return A pointer to the array of entities.
-     */
-    const entity_type * data() const ENTT_NOEXCEPT {
-        return pool.data();
+    unchecked_type unchecked(const view_type *view) const ENTT_NOEXCEPT {
+        unchecked_type other{};
+        std::size_t pos{};
+        using accumulator_type = const view_type *[];
+        accumulator_type accumulator = { (&pool<Component>() == view ? view : other[pos++] = &pool<Component>())... };
+        (void)accumulator;
+        return other;
     }
 
-    /**
+    typename view_type::size_type extent() const ENTT_NOEXCEPT {
+        return std::min({ pool<Component>().extent()... });
+    }
+
+    template<typename Comp, typename Other>
+    inline std::enable_if_t<std::is_same<Comp, Other>::value, typename pool_type<Other>::const_reference_type>
+    get(const component_iterator_type<Comp> &it, const Entity) const ENTT_NOEXCEPT { return *it; }
+
+    template<typename Comp, typename Other>
+    inline std::enable_if_t<!std::is_same<Comp, Other>::value, typename pool_type<Other>::const_reference_type>
+    get(const component_iterator_type<Comp> &, const Entity entity) const ENTT_NOEXCEPT { return pool<Other>().get(entity); }
+
+    void prefetch(const unchecked_type &other, const Entity entity) const ENTT_NOEXCEPT {
+        // the candidate pool is walked sequentially, only the other ones are accessed randomly
+        for(const auto *view: other) {
+            view->prefetch(entity);
+        }
+    }
+
+    void prefetch_objects(const view_type *view, const Entity entity) const ENTT_NOEXCEPT {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (&pool<Component>() == view ? void() : pool<Component>().prefetch_object(entity), 0)... };
+        (void)accumulator;
+    }
+
+    template<typename Comp, typename Func, std::size_t... Indexes>
+    void each(const pool_type<Comp> &cpool, Func func, std::index_sequence<Indexes...>) const {
+        const auto other = unchecked(&cpool);
+        std::array<underlying_iterator_type, sizeof...(Component)> data{{cpool.view_type::cbegin(), std::get<Indexes>(other)->cbegin()...}};
+        auto raw = std::make_tuple(pool<Component>().cbegin()...);
+        const auto end = cpool.view_type::cend();
+        std::size_t pos{};
+
+        // we can directly use the raw iterators if pools are ordered
+        while(!pos && data[0] != end) {
+            for(pos = data.size() - 1; pos && *(data[pos]++) == *data[pos-1]; --pos);
+
+            if(!pos) {
+                func(*(data[0]++), *(std::get<component_iterator_type<Component>>(raw)++)...);
+            }
+        }
+
+        auto it = std::get<component_iterator_type<Comp>>(raw);
+        const auto ext = extent();
+        auto slots = data[0];
+        auto objects = data[0];
+
+        // sparse slots are prefetched well in advance, components only once their positions are likely in cache
+        for(auto dist = 0; ENTT_PREFETCH_DISTANCE && dist < ENTT_PREFETCH_DISTANCE && slots != end; ++dist, ++slots) {
+            prefetch(other, *slots);
+
+            if(dist < ENTT_PREFETCH_DISTANCE / 2) {
+                ++objects;
+            }
+        }
+
+        // fallback to visit what remains using indirections
+        for(; data[0] != end; ++data[0], ++it) {
+            if(ENTT_PREFETCH_DISTANCE && slots != end) {
+                prefetch(other, *(slots++));
+            }
+
+            if(ENTT_PREFETCH_DISTANCE && objects != end) {
+                prefetch_objects(&cpool, *(objects++));
+            }
+
+            const auto entity = *data[0];
+            const auto sz = size_type(entity & traits_type::entity_mask);
+
+            if(sz < ext && std::all_of(other.cbegin(), other.cend(), [entity](const view_type *view) { return view->fast(entity); })) {
+                // avoided at least the indirection due to the sparse set for the pivot type (see get for more details)
+                func(entity, get<Comp, Component>(it, entity)...);
+            }
+        }
+    }
+
+public:
+    /*! @brief Input iterator type. */
+    using iterator_type = Iterator;
+    /*! @brief Constant input iterator type. */
+    using const_iterator_type = Iterator;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename view_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = typename view_type::size_type;
+
+    /**
+     * @brief Estimates the number of entities that have the given components.
+     * @return Estimated number of entities that have the given components.
+     */
+    size_type size() const ENTT_NOEXCEPT {
+        return std::min({ pool<Component>().size()... });
+    }
+
+    /**
+     * @brief Checks if the view is definitely empty.
+     * @return True if the view is definitely empty, false otherwise.
+     */
+    bool empty() const ENTT_NOEXCEPT {
+        return std::max({ pool<Component>().empty()... });
+    }
+
+    /**
      * @brief Returns an iterator to the first entity that has the given
-     * component.
+     * components.
      *
      * The returned iterator points to the first entity that has the given
-     * component. If the view is empty, the returned iterator will be equal to
+     * components. If the view is empty, the returned iterator will be equal to
      * `end()`.
      *
      * @note
      * Input iterators stay true to the order imposed to the underlying data
      * structures.
      *
-     * @return An iterator to the first entity that has the given component.
+     * @return An iterator to the first entity that has the given components.
      */
     const_iterator_type cbegin() const ENTT_NOEXCEPT {
-        return pool.view_type::cbegin();
+        const auto *view = candidate();
+        return iterator_type{ unchecked(view), extent(), view->cbegin(), view->cend() };
     }
 
     /**
      * @brief Returns an iterator to the first entity that has the given
-     * component.
+     * components.
      *
      * The returned iterator points to the first entity that has the given
-     * component. If the view is empty, the returned iterator will be equal to
+     * components. If the view is empty, the returned iterator will be equal to
      * `end()`.
      *
      * @note
      * Input iterators stay true to the order imposed to the underlying data
      * structures.
      *
-     * @return An iterator to the first entity that has the given component.
+     * @return An iterator to the first entity that has the given components.
      */
     inline const_iterator_type begin() const ENTT_NOEXCEPT {
         return cbegin();
@@ -1064,28 +1226,28 @@ public:
 
     /**
      * @brief Returns an iterator to the first entity that has the given
-     * component.
+     * components.
      *
      * The returned iterator points to the first entity that has the given
-     * component. If the view is empty, the returned iterator will be equal to
+     * components. If the view is empty, the returned iterator will be equal to
      * `end()`.
      *
      * @note
      * Input iterators stay true to the order imposed to the underlying data
      * structures.
      *
-     * @return An iterator to the first entity that has the given component.
+     * @return An iterator to the first entity that has the given components.
      */
-    iterator_type begin() ENTT_NOEXCEPT {
-        return pool.view_type::begin();
+    inline iterator_type begin() ENTT_NOEXCEPT {
+        return cbegin();
     }
 
     /**
      * @brief Returns an iterator that is past the last entity that has the
-     * given component.
+     * given components.
      *
      * The returned iterator points to the entity following the last entity that
-     * has the given component. Attempting to dereference the returned iterator
+     * has the given components. Attempting to dereference the returned iterator
      * results in undefined behavior.
      *
      * @note
@@ -1093,18 +1255,19 @@ public:
      * structures.
      *
      * @return An iterator to the entity following the last entity that has the
-     * given component.
+     * given components.
      */
     const_iterator_type cend() const ENTT_NOEXCEPT {
-        return pool.view_type::cend();
+        const auto *view = candidate();
+        return iterator_type{ unchecked(view), extent(), view->cend(), view->cend() };
     }
 
     /**
      * @brief Returns an iterator that is past the last entity that has the
-     * given component.
+     * given components.
      *
      * The returned iterator points to the entity following the last entity that
-     * has the given component. Attempting to dereference the returned iterator
+     * has the given components. Attempting to dereference the returned iterator
      * results in undefined behavior.
      *
      * @note
@@ -1112,7 +1275,7 @@ public:
      * structures.
      *
      * @return An iterator to the entity following the last entity that has the
-     * given component.
+     * given components.
      */
     inline const_iterator_type end() const ENTT_NOEXCEPT {
         return cend();
@@ -1120,10 +1283,10 @@ public:
 
     /**
      * @brief Returns an iterator that is past the last entity that has the
-     * given component.
+     * given components.
      *
      * The returned iterator points to the entity following the last entity that
-     * has the given component. Attempting to dereference the returned iterator
+     * has the given components. Attempting to dereference the returned iterator
      * results in undefined behavior.
      *
      * @note
@@ -1131,10 +1294,10 @@ public:
      * structures.
      *
      * @return An iterator to the entity following the last entity that has the
-     * given component.
+     * given components.
      */
-    iterator_type end() ENTT_NOEXCEPT {
-        return pool.view_type::end();
+    inline iterator_type end() ENTT_NOEXCEPT {
+        return cend();
     }
 
     /**
@@ -1143,7 +1306,8 @@ public:
      * @return True if the view contains the given entity, false otherwise.
      */
     bool contains(const entity_type entity) const ENTT_NOEXCEPT {
-        return pool.has(entity) && (pool.data()[pool.view_type::get(entity)] == entity);
+        const auto sz = size_type(entity & traits_type::entity_mask);
+        return sz < extent() && std::min({ (pool<Component>().has(entity) && (pool<Component>().data()[pool<Component>().view_type::get(entity)] == entity))... });
     }
 
     /**
@@ -1153,17 +1317,20 @@ public:
      * far better performance than its companion function.
      *
      * @warning
-     * Attempting to use an entity that doesn't belong to the view results in
-     * undefined behavior.<br/>
+     * Attempting to use an invalid component type results in a compilation
+     * error. Attempting to use an entity that doesn't belong to the view
+     * results in undefined behavior.<br/>
      * An assertion will abort the execution at runtime in debug mode if the
      * view doesn't contain the given entity.
      *
+     * @tparam Comp Type of component to get.
      * @param entity A valid entity identifier.
      * @return The component assigned to the entity.
      */
-    const Component & get(const entity_type entity) const ENTT_NOEXCEPT {
+    template<typename Comp>
+    typename pool_type<Comp>::const_reference_type get(const entity_type entity) const ENTT_NOEXCEPT {
         assert(contains(entity));
-        return pool.get(entity);
+        return pool<Comp>().get(entity);
     }
 
     /**
@@ -1173,16 +1340,67 @@ public:
      * far better performance than its companion function.
      *
      * @warning
+     * Attempting to use an invalid component type results in a compilation
+     * error. Attempting to use an entity that doesn't belong to the view
+     * results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * view doesn't contain the given entity.
+     *
+     * @tparam Comp Type of component to get.
+     * @param entity A valid entity identifier.
+     * @return The component assigned to the entity.
+     */
+    template<typename Comp>
+    inline typename pool_type<Comp>::reference_type get(const entity_type entity) ENTT_NOEXCEPT {
+        return internal::unconst(const_cast<const View *>(this)->get<Comp>(entity));
+    }
+
+    /**
+     * @brief Returns the components assigned to the given entity.
+     *
+     * Prefer this function instead of `Registry::get` during iterations. It has
+     * far better performance than its companion function.
+     *
+     * @warning
+     * Attempting to use invalid component types results in a compilation error.
      * Attempting to use an entity that doesn't belong to the view results in
      * undefined behavior.<br/>
      * An assertion will abort the execution at runtime in debug mode if the
      * view doesn't contain the given entity.
      *
+     * @tparam Comp Types of the components to get.
      * @param entity A valid entity identifier.
-     * @return The component assigned to the entity.
+     * @return The components assigned to the entity.
+     */
+    template<typename... Comp>
+    inline std::enable_if_t<(sizeof...(Comp) > 1), std::tuple<typename pool_type<Comp>::const_reference_type...>>
+    get(const entity_type entity) const ENTT_NOEXCEPT {
+        assert(contains(entity));
+        return std::tuple<typename pool_type<Comp>::const_reference_type...>{get<Comp>(entity)...};
+    }
+
+    /**
+     * @brief Returns the components assigned to the given entity.
+     *
+     * Prefer this function instead of `Registry::get` during iterations. It has
+     * far better performance than its companion function.
+     *
+     * @warning
+     * Attempting to use invalid component types results in a compilation error.
+     * Attempting to use an entity that doesn't belong to the view results in
+     * undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * view doesn't contain the given entity.
+     *
+     * @tparam Comp Types of the components to get.
+     * @param entity A valid entity identifier.
+     * @return The components assigned to the entity.
      */
-    inline Component & get(const entity_type entity) ENTT_NOEXCEPT {
-        return const_cast<Component &>(const_cast<const View *>(this)->get(entity));
+    template<typename... Comp>
+    inline std::enable_if_t<(sizeof...(Comp) > 1), std::tuple<typename pool_type<Comp>::reference_type...>>
+    get(const entity_type entity) ENTT_NOEXCEPT {
+        assert(contains(entity));
+        return std::tuple<typename pool_type<Comp>::reference_type...>{get<Comp>(entity)...};
     }
 
     /**
@@ -1190,11 +1408,12 @@ public:
      * object to them.
      *
      * The function object is invoked for each entity. It is provided with the
-     * entity itself and a const reference to the component of the view.<br/>
+     * entity itself and a set of const references to all the components of the
+     * view.<br/>
      * The signature of the function should be equivalent to the following:
      *
      * @code{.cpp}
-     * void(const entity_type, const Component &);
+     * void(const entity_type, const Component &...);
      * @endcode
      *
      * @tparam Func Type of the function object to invoke.
@@ -1202,9 +1421,10 @@ public:
      */
     template<typename Func>
     void each(Func func) const {
-        std::for_each(pool.view_type::cbegin(), pool.view_type::cend(), [&func, raw = pool.cbegin()](const auto entity) mutable {
-            func(entity, *(raw++));
-        });
+        const auto *view = candidate();
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (&pool<Component>() == view ? (each(pool<Component>(), std::move(func), std::make_index_sequence<sizeof...(Component)-1>{}), 0) : 0)... };
+        (void)accumulator;
     }
 
     /**
@@ -1212,11 +1432,12 @@ public:
      * object to them.
      *
      * The function object is invoked for each entity. It is provided with the
-     * entity itself and a reference to the component of the view.<br/>
+     * entity itself and a set of references to all the components of the
+     * view.<br/>
      * The signature of the function should be equivalent to the following:
      *
      * @code{.cpp}
-     * void(const entity_type, Component &);
+     * void(const entity_type, Component &...);
      * @endcode
      *
      * @tparam Func Type of the function object to invoke.
@@ -1224,25 +1445,97 @@ public:
      */
     template<typename Func>
     inline void each(Func func) {
-        const_cast<const View *>(this)->each([&func](const entity_type entity, const Component &component) {
-            func(entity, const_cast<Component &>(component));
+        const_cast<const View *>(this)->each([&func](const entity_type entity, auto &&... component) {
+            func(entity, internal::unconst(component)...);
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components in parallel and applies the given
+     * function object to them.
+     *
+     * Entities are split in chunks of `ENTT_CHUNK_SIZE` elements and each chunk
+     * is a job for the given executor (see ThreadPool for more details about
+     * executors). The function object is invoked for each entity. It is
+     * provided with the entity itself and a set of const references to all the
+     * components of the view.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, const Component &...);
+     * @endcode
+     *
+     * @sa ThreadPool
+     *
+     * @tparam Executor Type of executor to use to run the jobs.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Executor, typename Func>
+    void par_each(Executor &&executor, Func func) const {
+        const auto *view = candidate();
+        const auto other = unchecked(view);
+        const auto *entities = view->data();
+        const auto sz = view->size();
+        const auto ext = extent();
+
+        executor((sz + ENTT_CHUNK_SIZE - 1) / ENTT_CHUNK_SIZE, [&func, &other, entities, sz, ext, this](const size_type chunk) {
+            const auto last = std::min(sz, (chunk + 1) * ENTT_CHUNK_SIZE);
+
+            for(auto pos = chunk * ENTT_CHUNK_SIZE; pos < last; ++pos) {
+                const auto entity = entities[pos];
+                const auto curr = size_type(entity & traits_type::entity_mask);
+
+                if(curr < ext && std::all_of(other.cbegin(), other.cend(), [entity](const view_type *view) { return view->fast(entity); })) {
+                    func(entity, pool<Component>().get(entity)...);
+                }
+            }
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components in parallel and applies the given
+     * function object to them.
+     *
+     * Entities are split in chunks of `ENTT_CHUNK_SIZE` elements and each chunk
+     * is a job for the given executor (see ThreadPool for more details about
+     * executors). The function object is invoked for each entity. It is
+     * provided with the entity itself and a set of references to all the
+     * components of the view.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &...);
+     * @endcode
+     *
+     * @sa ThreadPool
+     *
+     * @tparam Executor Type of executor to use to run the jobs.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Executor, typename Func>
+    inline void par_each(Executor &&executor, Func func) {
+        const_cast<const View *>(this)->par_each(std::forward<Executor>(executor), [&func](const entity_type entity, auto &&... component) {
+            func(entity, internal::unconst(component)...);
         });
     }
 
 private:
-    pool_type &pool;
+    const pattern_type pools;
 };
 
 
 /**
- * @brief Raw view.
+ * @brief Single component view specialization.
  *
- * Raw views are meant to easily iterate components without having to resort to
- * using any other member function, so as to further increase the performance.
- * Whenever knowing the entity to which a component belongs isn't required, this
- * should be the preferred tool.<br/>
- * Order of elements during iterations are highly dependent on the order of the
- * underlying data structure. See SparseSet and its specializations for more
+ * Single component views are specialized in order to get a boost in terms of
+ * performance. This kind of views can access the underlying data structure
+ * directly and avoid superfluous checks.<br/>
+ * Order of elements during iterations are highly dependent on the order of the
+ * underlying data structure. See SparseSet and its specializations for more
  * details.
  *
  * @b Important
@@ -1250,8 +1543,8 @@ private:
  * Iterators aren't invalidated if:
  *
  * * New instances of the given component are created and assigned to entities.
- * * The entity to which the component belongs is modified (as an example, the
- *   given component is destroyed).
+ * * The entity currently pointed is modified (as an example, the given
+ *   component is removed from the entity to which the iterator points).
  *
  * In all the other cases, modifying the pool of the given component in any way
  * invalidates all the iterators and using them results in undefined behavior.
@@ -1266,28 +1559,29 @@ private:
  * In any other case, attempting to use a view results in undefined behavior.
  *
  * @sa View
- * @sa View<Entity, Component>
  * @sa PersistentView
+ * @sa RawView
  *
  * @tparam Entity A valid entity type (see entt_traits for more details).
  * @tparam Component Type of component iterated by the view.
  */
 template<typename Entity, typename Component>
-class RawView final {
+class View<Entity, Component> final {
     /*! @brief A registry is allowed to create views. */
     friend class Registry<Entity>;
 
+    using view_type = SparseSet<Entity>;
     using pool_type = SparseSet<Entity, Component>;
 
-    RawView(pool_type &pool) ENTT_NOEXCEPT
+    View(pool_type &pool) ENTT_NOEXCEPT
         : pool{pool}
     {}
 
 public:
     /*! @brief Input iterator type. */
-    using iterator_type = typename pool_type::iterator_type;
+    using iterator_type = typename view_type::iterator_type;
     /*! @brief Constant input iterator type. */
-    using const_iterator_type = typename pool_type::const_iterator_type;
+    using const_iterator_type = typename view_type::const_iterator_type;
     /*! @brief Underlying entity identifier. */
     using entity_type = typename pool_type::entity_type;
     /*! @brief Unsigned integer type. */
@@ -1296,8 +1590,8 @@ public:
     using raw_type = typename pool_type::object_type;
 
     /**
-     * @brief Returns the number of instances of the given type.
-     * @return Number of instances of the given component.
+     * @brief Returns the number of entities that have the given component.
+     * @return Number of entities that have the given component.
      */
     size_type size() const ENTT_NOEXCEPT {
         return pool.size();
@@ -1323,7 +1617,7 @@ public:
      *
      * @return A pointer to the array of components.
      */
-    const raw_type * raw() const ENTT_NOEXCEPT {
+    typename pool_type::const_pointer_type raw() const ENTT_NOEXCEPT {
         return pool.raw();
     }
 
@@ -1339,8 +1633,8 @@ public:
      *
      * @return A pointer to the array of components.
      */
-    inline raw_type * raw() ENTT_NOEXCEPT {
-        return const_cast<raw_type *>(const_cast<const RawView *>(this)->raw());
+    typename pool_type::pointer_type raw() ENTT_NOEXCEPT {
+        return pool.raw();
     }
 
     /**
@@ -1360,119 +1654,174 @@ public:
     }
 
     /**
-     * @brief Returns an iterator to the first instance of the given type.
+     * @brief Returns an iterator to the first entity that has the given
+     * component.
      *
-     * The returned iterator points to the first instance of the given type. If
-     * the view is empty, the returned iterator will be equal to `end()`.
+     * The returned iterator points to the first entity that has the given
+     * component. If the view is empty, the returned iterator will be equal to
+     * `end()`.
      *
      * @note
      * Input iterators stay true to the order imposed to the underlying data
      * structures.
      *
-     * @return An iterator to the first instance of the given type.
+     * @return An iterator to the first entity that has the given component.
      */
     const_iterator_type cbegin() const ENTT_NOEXCEPT {
-        return pool.cbegin();
+        return pool.view_type::cbegin();
     }
 
     /**
-     * @brief Returns an iterator to the first instance of the given type.
+     * @brief Returns an iterator to the first entity that has the given
+     * component.
      *
-     * The returned iterator points to the first instance of the given type. If
-     * the view is empty, the returned iterator will be equal to `end()`.
+     * The returned iterator points to the first entity that has the given
+     * component. If the view is empty, the returned iterator will be equal to
+     * `end()`.
      *
      * @note
      * Input iterators stay true to the order imposed to the underlying data
      * structures.
      *
-     * @return An iterator to the first instance of the given type.
+     * @return An iterator to the first entity that has the given component.
      */
     inline const_iterator_type begin() const ENTT_NOEXCEPT {
         return cbegin();
     }
 
     /**
-     * @brief Returns an iterator to the first instance of the given type.
+     * @brief Returns an iterator to the first entity that has the given
+     * component.
      *
-     * The returned iterator points to the first instance of the given type. If
-     * the view is empty, the returned iterator will be equal to `end()`.
+     * The returned iterator points to the first entity that has the given
+     * component. If the view is empty, the returned iterator will be equal to
+     * `end()`.
      *
      * @note
      * Input iterators stay true to the order imposed to the underlying data
      * structures.
      *
-     * @return An iterator to the first instance of the given type.
+     * @return An iterator to the first entity that has the given component.
      */
     iterator_type begin() ENTT_NOEXCEPT {
-        return pool.begin();
+        return pool.view_type::begin();
     }
 
     /**
-     * @brief Returns an iterator that is past the last instance of the given
-     * type.
+     * @brief Returns an iterator that is past the last entity that has the
+     * given component.
      *
-     * The returned iterator points to the element following the last instance
-     * of the given type. Attempting to dereference the returned iterator
+     * The returned iterator points to the entity following the last entity that
+     * has the given component. Attempting to dereference the returned iterator
      * results in undefined behavior.
      *
      * @note
      * Input iterators stay true to the order imposed to the underlying data
      * structures.
      *
-     * @return An iterator to the element following the last instance of the
-     * given type.
+     * @return An iterator to the entity following the last entity that has the
+     * given component.
      */
     const_iterator_type cend() const ENTT_NOEXCEPT {
-        return pool.cend();
+        return pool.view_type::cend();
     }
 
     /**
-     * @brief Returns an iterator that is past the last instance of the given
-     * type.
+     * @brief Returns an iterator that is past the last entity that has the
+     * given component.
      *
-     * The returned iterator points to the element following the last instance
-     * of the given type. Attempting to dereference the returned iterator
+     * The returned iterator points to the entity following the last entity that
+     * has the given component. Attempting to dereference the returned iterator
      * results in undefined behavior.
      *
      * @note
      * Input iterators stay true to the order imposed to the underlying data
      * structures.
      *
-     * @return An iterator to the element following the last instance of the
-     * given type.
+     * @return An iterator to the entity following the last entity that has the
+     * given component.
      */
     inline const_iterator_type end() const ENTT_NOEXCEPT {
         return cend();
     }
 
     /**
-     * @brief Returns an iterator that is past the last instance of the given
-     * type.
+     * @brief Returns an iterator that is past the last entity that has the
+     * given component.
      *
-     * The returned iterator points to the element following the last instance
-     * of the given type. Attempting to dereference the returned iterator
+     * The returned iterator points to the entity following the last entity that
+     * has the given component. Attempting to dereference the returned iterator
      * results in undefined behavior.
      *
      * @note
      * Input iterators stay true to the order imposed to the underlying data
      * structures.
      *
-     * @return An iterator to the element following the last instance of the
-     * given type.
+     * @return An iterator to the entity following the last entity that has the
+     * given component.
      */
     iterator_type end() ENTT_NOEXCEPT {
-        return pool.end();
+        return pool.view_type::end();
     }
 
     /**
-     * @brief Iterates components and applies the given function object to them.
+     * @brief Checks if a view contains an entity.
+     * @param entity A valid entity identifier.
+     * @return True if the view contains the given entity, false otherwise.
+     */
+    bool contains(const entity_type entity) const ENTT_NOEXCEPT {
+        return pool.has(entity) && (pool.data()[pool.view_type::get(entity)] == entity);
+    }
+
+    /**
+     * @brief Returns the component assigned to the given entity.
      *
-     * The function object is provided with a const reference to each component
-     * of the view.<br/>
+     * Prefer this function instead of `Registry::get` during iterations. It has
+     * far better performance than its companion function.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the view results in
+     * undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * view doesn't contain the given entity.
+     *
+     * @param entity A valid entity identifier.
+     * @return The component assigned to the entity.
+     */
+    typename pool_type::const_reference_type get(const entity_type entity) const ENTT_NOEXCEPT {
+        assert(contains(entity));
+        return pool.get(entity);
+    }
+
+    /**
+     * @brief Returns the component assigned to the given entity.
+     *
+     * Prefer this function instead of `Registry::get` during iterations. It has
+     * far better performance than its companion function.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the view results in
+     * undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * view doesn't contain the given entity.
+     *
+     * @param entity A valid entity identifier.
+     * @return The component assigned to the entity.
+     */
+    inline typename pool_type::reference_type get(const entity_type entity) ENTT_NOEXCEPT {
+        return internal::unconst(const_cast<const View *>(this)->get(entity));
+    }
+
+    /**
+     * @brief Iterates entities and components and applies the given function
+     * object to them.
+     *
+     * The function object is invoked for each entity. It is provided with the
+     * entity itself and a const reference to the component of the view.<br/>
      * The signature of the function should be equivalent to the following:
      *
      * @code{.cpp}
-     * void(const Component &);
+     * void(const entity_type, const Component &);
      * @endcode
      *
      * @tparam Func Type of the function object to invoke.
@@ -1480,26 +1829,183 @@ public:
      */
     template<typename Func>
     void each(Func func) const {
-        std::for_each(pool.cbegin(), pool.cend(), func);
+        std::for_each(pool.view_type::cbegin(), pool.view_type::cend(), [&func, raw = pool.cbegin()](const auto entity) mutable {
+            func(entity, *(raw++));
+        });
     }
 
     /**
-     * @brief Iterates components and applies the given function object to them.
+     * @brief Iterates entities and components and applies the given function
+     * object to them.
      *
-     * The function object is provided with a const reference to each component
-     * of the view.<br/>
+     * The function object is invoked for each entity. It is provided with the
+     * entity itself and a reference to the component of the view.<br/>
      * The signature of the function should be equivalent to the following:
      *
      * @code{.cpp}
-     * void(const Component &);
+     * void(const entity_type, Component &);
      * @endcode
      *
      * @tparam Func Type of the function object to invoke.
      * @param func A valid function object.
      */
     template<typename Func>
-    void each(Func func) {
-        std::for_each(pool.begin(), pool.end(), func);
+    inline void each(Func func) {
+        const_cast<const View *>(this)->each([&func](const entity_type entity, auto &&component) {
+            func(entity, internal::unconst(component));
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components in parallel and applies the given
+     * function object to them.
+     *
+     * Entities are split in chunks of `ENTT_CHUNK_SIZE` elements and each chunk
+     * is a job for the given executor (see ThreadPool for more details about
+     * executors). The function object is invoked for each entity. It is
+     * provided with the entity itself and a const reference to the component of
+     * the view.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, const Component &);
+     * @endcode
+     *
+     * @sa ThreadPool
+     *
+     * @tparam Executor Type of executor to use to run the jobs.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Executor, typename Func>
+    void par_each(Executor &&executor, Func func) const {
+        const auto *entities = pool.view_type::data();
+        const auto instances = pool.raw();
+        const auto sz = pool.size();
+
+        executor((sz + ENTT_CHUNK_SIZE - 1) / ENTT_CHUNK_SIZE, [&func, entities, instances, sz](const size_type chunk) {
+            const auto last = std::min(sz, (chunk + 1) * ENTT_CHUNK_SIZE);
+
+            for(auto pos = chunk * ENTT_CHUNK_SIZE; pos < last; ++pos) {
+                func(entities[pos], internal::element(instances, pos));
+            }
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components in parallel and applies the given
+     * function object to them.
+     *
+     * Entities are split in chunks of `ENTT_CHUNK_SIZE` elements and each chunk
+     * is a job for the given executor (see ThreadPool for more details about
+     * executors). The function object is invoked for each entity. It is
+     * provided with the entity itself and a reference to the component of the
+     * view.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &);
+     * @endcode
+     *
+     * @sa ThreadPool
+     *
+     * @tparam Executor Type of executor to use to run the jobs.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Executor, typename Func>
+    inline void par_each(Executor &&executor, Func func) {
+        const_cast<const View *>(this)->par_each(std::forward<Executor>(executor), [&func](const entity_type entity, auto &&component) {
+            func(entity, internal::unconst(component));
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components in chunks and applies the given
+     * function object to them.
+     *
+     * The packed arrays of entities and components are split in chunks of at
+     * most `ENTT_CHUNK_SIZE` elements and the function object is invoked once
+     * for each chunk. It is provided with a pointer to the first entity and a
+     * pointer to the first component of the chunk, then with the number of
+     * elements in the chunk. Chunks start at multiples of `ENTT_CHUNK_SIZE`
+     * elements from the beginning of the arrays, so they preserve the
+     * alignment of the arrays themselves.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type *, const Component *, const size_type);
+     * @endcode
+     *
+     * This is meant for tight loops that compilers can vectorize or for
+     * explicit SIMD kernels.
+     *
+     * @note
+     * Chunks are visited in the order of the packed arrays, that is the
+     * opposite of the one of the iterators.
+     *
+     * @warning
+     * Components of empty types aren't stored. In this case, the pointer to
+     * the components of each chunk refers to the only instance shared by all
+     * the entities.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_chunk(Func func) const {
+        const auto *entities = pool.view_type::data();
+        const typename pool_type::const_pointer_type instances = pool.raw();
+        const auto sz = pool.size();
+
+        for(size_type pos{}; pos < sz; pos += ENTT_CHUNK_SIZE) {
+            func(entities + pos, internal::offset(instances, pos), std::min(sz - pos, size_type{ENTT_CHUNK_SIZE}));
+        }
+    }
+
+    /**
+     * @brief Iterates entities and components in chunks and applies the given
+     * function object to them.
+     *
+     * The packed arrays of entities and components are split in chunks of at
+     * most `ENTT_CHUNK_SIZE` elements and the function object is invoked once
+     * for each chunk. It is provided with a pointer to the first entity and a
+     * pointer to the first component of the chunk, then with the number of
+     * elements in the chunk. Chunks start at multiples of `ENTT_CHUNK_SIZE`
+     * elements from the beginning of the arrays, so they preserve the
+     * alignment of the arrays themselves.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type *, Component *, const size_type);
+     * @endcode
+     *
+     * This is meant for tight loops that compilers can vectorize or for
+     * explicit SIMD kernels.
+     *
+     * @note
+     * Chunks are visited in the order of the packed arrays, that is the
+     * opposite of the one of the iterators.
+     *
+     * @warning
+     * Components of empty types aren't stored. In this case, the pointer to
+     * the components of each chunk refers to the only instance shared by all
+     * the entities.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_chunk(Func func) {
+        const auto *entities = pool.view_type::data();
+        const auto instances = pool.raw();
+        const auto sz = pool.size();
+
+        for(size_type pos{}; pos < sz; pos += ENTT_CHUNK_SIZE) {
+            func(entities + pos, internal::offset(instances, pos), std::min(sz - pos, size_type{ENTT_CHUNK_SIZE}));
+        }
     }
 
 private:
@@ -1507,6 +2013,1144 @@ private:
 };
 
 
+/**
+ * @brief View with exclusion list.
+ *
+ * Views with an exclusion list iterate over those entities that have at least
+ * all the given components in their bags and none of the excluded ones. They
+ * rely on a standard view to select the set of candidate entities, then they
+ * filter out those entities that have at least one of the excluded components.
+ * Excluded components are never returned to the caller.<br/>
+ * Order of elements during iterations are highly dependent on the order of the
+ * underlying data structures. See SparseSet and its specializations for more
+ * details.
+ *
+ * @b Important
+ *
+ * Iterators aren't invalidated if:
+ *
+ * * New instances of the given components are created and assigned to entities.
+ * * The entity currently pointed is modified (as an example, if one of the
+ *   given components is removed from the entity to which the iterator points).
+ *
+ * In all the other cases, modifying the pools of the given components in any
+ * way invalidates all the iterators and using them results in undefined
+ * behavior.
+ *
+ * @note
+ * Views share references to the underlying data structures with the Registry
+ * that generated them. Therefore any change to the entities and to the
+ * components made by means of the registry are immediately reflected by views.
+ *
+ * @warning
+ * Lifetime of a view must overcome the one of the registry that generated it.
+ * In any other case, attempting to use a view results in undefined behavior.
+ *
+ * @sa View
+ * @sa View<Entity, Component>
+ * @sa PersistentView
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Exclude Types of components used to filter the view.
+ * @tparam Component Types of components iterated by the view.
+ */
+template<typename Entity, typename... Exclude, typename... Component>
+class View<Entity, exclude_t<Exclude...>, Component...> final {
+    static_assert(sizeof...(Component) > 0, "!");
+
+    /*! @brief A registry is allowed to create views. */
+    friend class Registry<Entity>;
+
+    template<typename Comp>
+    using pool_type = SparseSet<Entity, Comp>;
+
+    using view_type = SparseSet<Entity>;
+    using underlying_type = View<Entity, Component...>;
+    using filter_type = std::array<const view_type *, sizeof...(Exclude)>;
+    using pattern_type = std::tuple<pool_type<Component> &...>;
+
+    template<typename It>
+    class Iterator {
+        bool valid() const ENTT_NOEXCEPT {
+            const auto entity = *begin;
+
+            return std::none_of(filter.cbegin(), filter.cend(), [entity](const view_type *view) {
+                return view->has(entity);
+            });
+        }
+
+    public:
+        using difference_type = typename std::iterator_traits<It>::difference_type;
+        using value_type = typename std::iterator_traits<It>::value_type;
+        using pointer = typename std::iterator_traits<It>::pointer;
+        using reference = typename std::iterator_traits<It>::reference;
+        using iterator_category = std::input_iterator_tag;
+
+        Iterator(filter_type filter, It begin, It end) ENTT_NOEXCEPT
+            : filter{filter},
+              begin{begin},
+              end{end}
+        {
+            if(begin != end && !valid()) {
+                ++(*this);
+            }
+        }
+
+        Iterator & operator++() ENTT_NOEXCEPT {
+            return (++begin != end && !valid()) ? ++(*this) : *this;
+        }
+
+        Iterator operator++(int) ENTT_NOEXCEPT {
+            Iterator orig = *this;
+            return ++(*this), orig;
+        }
+
+        Iterator & operator+=(const difference_type value) ENTT_NOEXCEPT {
+            return ((begin += value) != end && !valid()) ? ++(*this) : *this;
+        }
+
+        Iterator operator+(const difference_type value) const ENTT_NOEXCEPT {
+            return Iterator{filter, begin+value, end};
+        }
+
+        bool operator==(const Iterator &other) const ENTT_NOEXCEPT {
+            return other.begin == begin;
+        }
+
+        inline bool operator!=(const Iterator &other) const ENTT_NOEXCEPT {
+            return !(*this == other);
+        }
+
+        value_type operator*() const ENTT_NOEXCEPT {
+            return *begin;
+        }
+
+    private:
+        const filter_type filter;
+        It begin;
+        It end;
+    };
+
+    View(underlying_type view, pool_type<Component> &... component, const pool_type<Exclude> &... exclude) ENTT_NOEXCEPT
+        : view{view},
+          pools{component...},
+          filter{{ static_cast<const view_type *>(&exclude)... }}
+    {}
+
+    bool excluded(const Entity entity) const ENTT_NOEXCEPT {
+        return std::any_of(filter.cbegin(), filter.cend(), [entity](const view_type *view) {
+            return view->has(entity);
+        });
+    }
+
+public:
+    /*! @brief Input iterator type. */
+    using iterator_type = Iterator<typename underlying_type::const_iterator_type>;
+    /*! @brief Constant input iterator type. */
+    using const_iterator_type = Iterator<typename underlying_type::const_iterator_type>;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename view_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = typename view_type::size_type;
+
+    /**
+     * @brief Estimates the number of entities that have the given components.
+     * @return Estimated number of entities that have the given components.
+     */
+    size_type size() const ENTT_NOEXCEPT {
+        return view.size();
+    }
+
+    /**
+     * @brief Checks if the view is definitely empty.
+     * @return True if the view is definitely empty, false otherwise.
+     */
+    bool empty() const ENTT_NOEXCEPT {
+        return view.empty();
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity that has the given
+     * components and none of the excluded ones.
+     *
+     * The returned iterator points to the first entity that has the given
+     * components and none of the excluded ones. If the view is empty, the
+     * returned iterator will be equal to `end()`.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the first entity that has the given components.
+     */
+    const_iterator_type cbegin() const ENTT_NOEXCEPT {
+        return const_iterator_type{filter, view.cbegin(), view.cend()};
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity that has the given
+     * components and none of the excluded ones.
+     *
+     * The returned iterator points to the first entity that has the given
+     * components and none of the excluded ones. If the view is empty, the
+     * returned iterator will be equal to `end()`.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the first entity that has the given components.
+     */
+    inline const_iterator_type begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity that has the given
+     * components and none of the excluded ones.
+     *
+     * The returned iterator points to the first entity that has the given
+     * components and none of the excluded ones. If the view is empty, the
+     * returned iterator will be equal to `end()`.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the first entity that has the given components.
+     */
+    inline iterator_type begin() ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity that has the
+     * given components and none of the excluded ones.
+     *
+     * The returned iterator points to the entity following the last entity that
+     * has the given components and none of the excluded ones. Attempting to
+     * dereference the returned iterator results in undefined behavior.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the entity following the last entity that has the
+     * given components.
+     */
+    const_iterator_type cend() const ENTT_NOEXCEPT {
+        return const_iterator_type{filter, view.cend(), view.cend()};
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity that has the
+     * given components and none of the excluded ones.
+     *
+     * The returned iterator points to the entity following the last entity that
+     * has the given components and none of the excluded ones. Attempting to
+     * dereference the returned iterator results in undefined behavior.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the entity following the last entity that has the
+     * given components.
+     */
+    inline const_iterator_type end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity that has the
+     * given components and none of the excluded ones.
+     *
+     * The returned iterator points to the entity following the last entity that
+     * has the given components and none of the excluded ones. Attempting to
+     * dereference the returned iterator results in undefined behavior.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the entity following the last entity that has the
+     * given components.
+     */
+    inline iterator_type end() ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    /**
+     * @brief Checks if a view contains an entity.
+     * @param entity A valid entity identifier.
+     * @return True if the view contains the given entity, false otherwise.
+     */
+    bool contains(const entity_type entity) const ENTT_NOEXCEPT {
+        return view.contains(entity) && !excluded(entity);
+    }
+
+    /**
+     * @brief Returns the component assigned to the given entity.
+     *
+     * Prefer this function instead of `Registry::get` during iterations. It has
+     * far better performance than its companion function.
+     *
+     * @warning
+     * Attempting to use an invalid component type results in a compilation
+     * error. Attempting to use an entity that doesn't belong to the view
+     * results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * view doesn't contain the given entity.
+     *
+     * @tparam Comp Type of component to get.
+     * @param entity A valid entity identifier.
+     * @return The component assigned to the entity.
+     */
+    template<typename Comp>
+    typename pool_type<Comp>::const_reference_type get(const entity_type entity) const ENTT_NOEXCEPT {
+        assert(contains(entity));
+        return std::get<pool_type<Comp> &>(pools).get(entity);
+    }
+
+    /**
+     * @brief Returns the component assigned to the given entity.
+     *
+     * Prefer this function instead of `Registry::get` during iterations. It has
+     * far better performance than its companion function.
+     *
+     * @warning
+     * Attempting to use an invalid component type results in a compilation
+     * error. Attempting to use an entity that doesn't belong to the view
+     * results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * view doesn't contain the given entity.
+     *
+     * @tparam Comp Type of component to get.
+     * @param entity A valid entity identifier.
+     * @return The component assigned to the entity.
+     */
+    template<typename Comp>
+    inline typename pool_type<Comp>::reference_type get(const entity_type entity) ENTT_NOEXCEPT {
+        return internal::unconst(const_cast<const View *>(this)->get<Comp>(entity));
+    }
+
+    /**
+     * @brief Returns the components assigned to the given entity.
+     *
+     * Prefer this function instead of `Registry::get` during iterations. It has
+     * far better performance than its companion function.
+     *
+     * @warning
+     * Attempting to use invalid component types results in a compilation error.
+     * Attempting to use an entity that doesn't belong to the view results in
+     * undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * view doesn't contain the given entity.
+     *
+     * @tparam Comp Types of the components to get.
+     * @param entity A valid entity identifier.
+     * @return The components assigned to the entity.
+     */
+    template<typename... Comp>
+    inline std::enable_if_t<(sizeof...(Comp) > 1), std::tuple<typename pool_type<Comp>::const_reference_type...>>
+    get(const entity_type entity) const ENTT_NOEXCEPT {
+        assert(contains(entity));
+        return std::tuple<typename pool_type<Comp>::const_reference_type...>{get<Comp>(entity)...};
+    }
+
+    /**
+     * @brief Returns the components assigned to the given entity.
+     *
+     * Prefer this function instead of `Registry::get` during iterations. It has
+     * far better performance than its companion function.
+     *
+     * @warning
+     * Attempting to use invalid component types results in a compilation error.
+     * Attempting to use an entity that doesn't belong to the view results in
+     * undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * view doesn't contain the given entity.
+     *
+     * @tparam Comp Types of the components to get.
+     * @param entity A valid entity identifier.
+     * @return The components assigned to the entity.
+     */
+    template<typename... Comp>
+    inline std::enable_if_t<(sizeof...(Comp) > 1), std::tuple<typename pool_type<Comp>::reference_type...>>
+    get(const entity_type entity) ENTT_NOEXCEPT {
+        assert(contains(entity));
+        return std::tuple<typename pool_type<Comp>::reference_type...>{get<Comp>(entity)...};
+    }
+
+    /**
+     * @brief Iterates entities and components and applies the given function
+     * object to them.
+     *
+     * The function object is invoked for each entity that has none of the
+     * excluded components. It is provided with the entity itself and a set of
+     * const references to all the components of the view.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, const Component &...);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        view.each([&func, this](const entity_type entity, auto &&... component) {
+            if(!excluded(entity)) {
+                func(entity, component...);
+            }
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components and applies the given function
+     * object to them.
+     *
+     * The function object is invoked for each entity that has none of the
+     * excluded components. It is provided with the entity itself and a set of
+     * references to all the components of the view.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &...);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    inline void each(Func func) {
+        const_cast<const View *>(this)->each([&func](const entity_type entity, auto &&... component) {
+            func(entity, internal::unconst(component)...);
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components in parallel and applies the given
+     * function object to them.
+     *
+     * Entities are split in chunks of `ENTT_CHUNK_SIZE` elements and each chunk
+     * is a job for the given executor (see ThreadPool for more details about
+     * executors). The function object is invoked for each entity that has none
+     * of the excluded components. It is provided with the entity itself and a
+     * set of const references to all the components of the view.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, const Component &...);
+     * @endcode
+     *
+     * @sa ThreadPool
+     *
+     * @tparam Executor Type of executor to use to run the jobs.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Executor, typename Func>
+    void par_each(Executor &&executor, Func func) const {
+        view.par_each(std::forward<Executor>(executor), [&func, this](const entity_type entity, auto &&... component) {
+            if(!excluded(entity)) {
+                func(entity, component...);
+            }
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components in parallel and applies the given
+     * function object to them.
+     *
+     * Entities are split in chunks of `ENTT_CHUNK_SIZE` elements and each chunk
+     * is a job for the given executor (see ThreadPool for more details about
+     * executors). The function object is invoked for each entity that has none
+     * of the excluded components. It is provided with the entity itself and a
+     * set of references to all the components of the view.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &...);
+     * @endcode
+     *
+     * @sa ThreadPool
+     *
+     * @tparam Executor Type of executor to use to run the jobs.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Executor, typename Func>
+    inline void par_each(Executor &&executor, Func func) {
+        const_cast<const View *>(this)->par_each(std::forward<Executor>(executor), [&func](const entity_type entity, auto &&... component) {
+            func(entity, internal::unconst(component)...);
+        });
+    }
+
+private:
+    const underlying_type view;
+    const pattern_type pools;
+    const filter_type filter;
+};
+
+
+/**
+ * @brief Raw view.
+ *
+ * Raw views are meant to easily iterate components without having to resort to
+ * using any other member function, so as to further increase the performance.
+ * Whenever knowing the entity to which a component belongs isn't required, this
+ * should be the preferred tool.<br/>
+ * Order of elements during iterations are highly dependent on the order of the
+ * underlying data structure. See SparseSet and its specializations for more
+ * details.
+ *
+ * @b Important
+ *
+ * Iterators aren't invalidated if:
+ *
+ * * New instances of the given component are created and assigned to entities.
+ * * The entity to which the component belongs is modified (as an example, the
+ *   given component is destroyed).
+ *
+ * In all the other cases, modifying the pool of the given component in any way
+ * invalidates all the iterators and using them results in undefined behavior.
+ *
+ * @note
+ * Views share a reference to the underlying data structure with the Registry
+ * that generated them. Therefore any change to the entities and to the
+ * components made by means of the registry are immediately reflected by views.
+ *
+ * @warning
+ * Lifetime of a view must overcome the one of the registry that generated it.
+ * In any other case, attempting to use a view results in undefined behavior.
+ *
+ * @sa View
+ * @sa View<Entity, Component>
+ * @sa PersistentView
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Component Type of component iterated by the view.
+ */
+template<typename Entity, typename Component>
+class RawView final {
+    /*! @brief A registry is allowed to create views. */
+    friend class Registry<Entity>;
+
+    using pool_type = SparseSet<Entity, Component>;
+
+    RawView(pool_type &pool) ENTT_NOEXCEPT
+        : pool{pool}
+    {}
+
+public:
+    /*! @brief Input iterator type. */
+    using iterator_type = typename pool_type::iterator_type;
+    /*! @brief Constant input iterator type. */
+    using const_iterator_type = typename pool_type::const_iterator_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename pool_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = typename pool_type::size_type;
+    /*! @brief Type of component iterated by the view. */
+    using raw_type = typename pool_type::object_type;
+
+    /**
+     * @brief Returns the number of instances of the given type.
+     * @return Number of instances of the given component.
+     */
+    size_type size() const ENTT_NOEXCEPT {
+        return pool.size();
+    }
+
+    /**
+     * @brief Checks whether the view is empty.
+     * @return True if the view is empty, false otherwise.
+     */
+    bool empty() const ENTT_NOEXCEPT {
+        return pool.empty();
+    }
+
+    /**
+     * @brief Direct access to the list of components.
+     *
+     * The returned pointer is such that range `[raw(), raw() + size()]` is
+     * always a valid range, even if the container is empty.
+     *
+     * @note
+     * There are no guarantees on the order of the components. Use `begin` and
+     * `end` if you want to iterate the view in the expected order.
+     *
+     * @warning
+     * Components of empty types aren't stored and the range isn't valid in this
+     * case (see SparseSet for more details).
+     *
+     * @return A pointer to the array of components.
+     */
+    typename pool_type::const_pointer_type raw() const ENTT_NOEXCEPT {
+        return pool.raw();
+    }
+
+    /**
+     * @brief Direct access to the list of components.
+     *
+     * The returned pointer is such that range `[raw(), raw() + size()]` is
+     * always a valid range, even if the container is empty.
+     *
+     * @note
+     * There are no guarantees on the order of the components. Use `begin` and
+     * `end` if you want to iterate the view in the expected order.
+     *
+     * @warning
+     * Components of empty types aren't stored and the range isn't valid in this
+     * case (see SparseSet for more details).
+     *
+     * @return A pointer to the array of components.
+     */
+    typename pool_type::pointer_type raw() ENTT_NOEXCEPT {
+        return pool.raw();
+    }
+
+    /**
+     * @brief Direct access to the list of entities.
+     *
+     * The returned pointer is such that range `[data(), data() + size()]` is
+     * always a valid range, even if the container is empty.
+     *
+     * @note
+     * There are no guarantees on the order of the entities. Use `begin` and
+     * `end` if you want to iterate the view in the expected order.
+     *
+     * @return A pointer to the array of entities.
+     */
+    const entity_type * data() const ENTT_NOEXCEPT {
+        return pool.data();
+    }
+
+    /**
+     * @brief Returns an iterator to the first instance of the given type.
+     *
+     * The returned iterator points to the first instance of the given type. If
+     * the view is empty, the returned iterator will be equal to `end()`.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the first instance of the given type.
+     */
+    const_iterator_type cbegin() const ENTT_NOEXCEPT {
+        return pool.cbegin();
+    }
+
+    /**
+     * @brief Returns an iterator to the first instance of the given type.
+     *
+     * The returned iterator points to the first instance of the given type. If
+     * the view is empty, the returned iterator will be equal to `end()`.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the first instance of the given type.
+     */
+    inline const_iterator_type begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    /**
+     * @brief Returns an iterator to the first instance of the given type.
+     *
+     * The returned iterator points to the first instance of the given type. If
+     * the view is empty, the returned iterator will be equal to `end()`.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the first instance of the given type.
+     */
+    iterator_type begin() ENTT_NOEXCEPT {
+        return pool.begin();
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last instance of the given
+     * type.
+     *
+     * The returned iterator points to the element following the last instance
+     * of the given type. Attempting to dereference the returned iterator
+     * results in undefined behavior.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the element following the last instance of the
+     * given type.
+     */
+    const_iterator_type cend() const ENTT_NOEXCEPT {
+        return pool.cend();
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last instance of the given
+     * type.
+     *
+     * The returned iterator points to the element following the last instance
+     * of the given type. Attempting to dereference the returned iterator
+     * results in undefined behavior.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the element following the last instance of the
+     * given type.
+     */
+    inline const_iterator_type end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last instance of the given
+     * type.
+     *
+     * The returned iterator points to the element following the last instance
+     * of the given type. Attempting to dereference the returned iterator
+     * results in undefined behavior.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the element following the last instance of the
+     * given type.
+     */
+    iterator_type end() ENTT_NOEXCEPT {
+        return pool.end();
+    }
+
+    /**
+     * @brief Iterates components and applies the given function object to them.
+     *
+     * The function object is provided with a const reference to each component
+     * of the view.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const Component &);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        std::for_each(pool.cbegin(), pool.cend(), func);
+    }
+
+    /**
+     * @brief Iterates components and applies the given function object to them.
+     *
+     * The function object is provided with a const reference to each component
+     * of the view.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const Component &);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) {
+        std::for_each(pool.begin(), pool.end(), func);
+    }
+
+    /**
+     * @brief Iterates components in chunks and applies the given function
+     * object to them.
+     *
+     * The packed array of components is split in chunks of at most
+     * `ENTT_CHUNK_SIZE` elements and the function object is invoked once for
+     * each chunk. It is provided with a pointer to the first component of the
+     * chunk and the number of elements in the chunk. Chunks start at multiples
+     * of `ENTT_CHUNK_SIZE` elements from the beginning of the array, so they
+     * preserve the alignment of the array itself.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const Component *, const size_type);
+     * @endcode
+     *
+     * @note
+     * Chunks are visited in the order of the packed array, that is the opposite
+     * of the one of the iterators.
+     *
+     * @warning
+     * Components of empty types aren't stored. In this case, the pointer of
+     * each chunk refers to the only instance shared by all the entities.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_chunk(Func func) const {
+        const typename pool_type::const_pointer_type instances = pool.raw();
+        const auto sz = pool.size();
+
+        for(size_type pos{}; pos < sz; pos += ENTT_CHUNK_SIZE) {
+            func(internal::offset(instances, pos), std::min(sz - pos, size_type{ENTT_CHUNK_SIZE}));
+        }
+    }
+
+    /**
+     * @brief Iterates components in chunks and applies the given function
+     * object to them.
+     *
+     * The packed array of components is split in chunks of at most
+     * `ENTT_CHUNK_SIZE` elements and the function object is invoked once for
+     * each chunk. It is provided with a pointer to the first component of the
+     * chunk and the number of elements in the chunk. Chunks start at multiples
+     * of `ENTT_CHUNK_SIZE` elements from the beginning of the array, so they
+     * preserve the alignment of the array itself.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(Component *, const size_type);
+     * @endcode
+     *
+     * @note
+     * Chunks are visited in the order of the packed array, that is the opposite
+     * of the one of the iterators.
+     *
+     * @warning
+     * Components of empty types aren't stored. In this case, the pointer of
+     * each chunk refers to the only instance shared by all the entities.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_chunk(Func func) {
+        const auto instances = pool.raw();
+        const auto sz = pool.size();
+
+        for(size_type pos{}; pos < sz; pos += ENTT_CHUNK_SIZE) {
+            func(internal::offset(instances, pos), std::min(sz - pos, size_type{ENTT_CHUNK_SIZE}));
+        }
+    }
+
+private:
+    pool_type &pool;
+};
+
+
+/**
+ * @brief Runtime view.
+ *
+ * Runtime views iterate over those entities that have at least all the given
+ * components in their bags. Components are identified by the runtime
+ * identifiers returned by the registry rather than by their types, so as to
+ * support cases in which types aren't known at compile-time (as an example,
+ * when they come from a scripting layer).<br/>
+ * During initialization, a runtime view looks at the number of entities
+ * available for each component and picks up a reference to the smallest set of
+ * candidate entities in order to get a performance boost when iterate.<br/>
+ * Order of elements during iterations are highly dependent on the order of the
+ * underlying data structures. See SparseSet and its specializations for more
+ * details.
+ *
+ * @b Important
+ *
+ * Iterators aren't invalidated if:
+ *
+ * * New instances of the given components are created and assigned to entities.
+ * * The entity currently pointed is modified (as an example, if one of the
+ *   given components is removed from the entity to which the iterator points).
+ *
+ * In all the other cases, modifying the pools of the given components in any
+ * way invalidates all the iterators and using them results in undefined
+ * behavior.
+ *
+ * @note
+ * Views share references to the underlying data structures with the Registry
+ * that generated them. Therefore any change to the entities and to the
+ * components made by means of the registry are immediately reflected by
+ * views, unless a pool didn't exist yet when the view was created. In this
+ * case, the view is empty and it must be created again.
+ *
+ * @warning
+ * Lifetime of a view must overcome the one of the registry that generated it.
+ * In any other case, attempting to use a view results in undefined behavior.
+ *
+ * @sa View
+ * @sa View<Entity, Component>
+ * @sa PersistentView
+ * @sa RawView
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class RuntimeView final {
+    /*! @brief A registry is allowed to create views. */
+    friend class Registry<Entity>;
+
+    using view_type = SparseSet<Entity>;
+    using underlying_iterator_type = typename view_type::const_iterator_type;
+    using pattern_type = std::vector<const view_type *>;
+    using unchecked_type = typename pattern_type::const_iterator;
+    using traits_type = entt_traits<Entity>;
+
+    class Iterator {
+        using size_type = typename view_type::size_type;
+
+        bool valid() const ENTT_NOEXCEPT {
+            const auto entity = *begin;
+            const auto sz = size_type(entity & traits_type::entity_mask);
+
+            return sz < extent && std::all_of(first, last, [entity](const view_type *view) {
+                return view->fast(entity);
+            });
+        }
+
+    public:
+        using difference_type = typename underlying_iterator_type::difference_type;
+        using value_type = typename underlying_iterator_type::value_type;
+        using pointer = typename underlying_iterator_type::pointer;
+        using reference = typename underlying_iterator_type::reference;
+        using iterator_category = typename underlying_iterator_type::iterator_category;
+
+        Iterator(unchecked_type first, unchecked_type last, size_type extent, underlying_iterator_type begin, underlying_iterator_type end) ENTT_NOEXCEPT
+            : first{first},
+              last{last},
+              extent{extent},
+              begin{begin},
+              end{end}
+        {
+            if(begin != end && !valid()) {
+                ++(*this);
+            }
+        }
+
+        Iterator & operator++() ENTT_NOEXCEPT {
+            return (++begin != end && !valid()) ? ++(*this) : *this;
+        }
+
+        Iterator operator++(int) ENTT_NOEXCEPT {
+            Iterator orig = *this;
+            return ++(*this), orig;
+        }
+
+        bool operator==(const Iterator &other) const ENTT_NOEXCEPT {
+            return other.begin == begin;
+        }
+
+        inline bool operator!=(const Iterator &other) const ENTT_NOEXCEPT {
+            return !(*this == other);
+        }
+
+        value_type operator*() const ENTT_NOEXCEPT {
+            return *begin;
+        }
+
+    private:
+        unchecked_type first;
+        unchecked_type last;
+        size_type extent;
+        underlying_iterator_type begin;
+        underlying_iterator_type end;
+    };
+
+    RuntimeView(pattern_type others) ENTT_NOEXCEPT
+        : pools{std::move(others)}
+    {
+        const auto it = std::min_element(pools.begin(), pools.end(), [](const auto *lhs, const auto *rhs) {
+            return (!lhs && rhs) || (lhs && rhs && lhs->size() < rhs->size());
+        });
+
+        // brings the candidate in front of the others, it's the only pool that isn't tested
+        if(it != pools.end()) {
+            std::iter_swap(pools.begin(), it);
+        }
+    }
+
+    bool valid() const ENTT_NOEXCEPT {
+        return !pools.empty() && pools.front();
+    }
+
+    typename view_type::size_type extent() const ENTT_NOEXCEPT {
+        typename view_type::size_type ext{};
+
+        if(valid()) {
+            const auto it = std::min_element(pools.cbegin(), pools.cend(), [](const auto *lhs, const auto *rhs) {
+                return lhs->extent() < rhs->extent();
+            });
+
+            ext = (*it)->extent();
+        }
+
+        return ext;
+    }
+
+public:
+    /*! @brief Input iterator type. */
+    using iterator_type = Iterator;
+    /*! @brief Constant input iterator type. */
+    using const_iterator_type = Iterator;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename view_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = typename view_type::size_type;
+
+    /**
+     * @brief Estimates the number of entities that have the given components.
+     * @return Estimated number of entities that have the given components.
+     */
+    size_type size() const ENTT_NOEXCEPT {
+        return valid() ? pools.front()->size() : size_type{};
+    }
+
+    /**
+     * @brief Checks if the view is definitely empty.
+     * @return True if the view is definitely empty, false otherwise.
+     */
+    bool empty() const ENTT_NOEXCEPT {
+        return !valid() || pools.front()->empty();
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity that has the given
+     * components.
+     *
+     * The returned iterator points to the first entity that has the given
+     * components. If the view is empty, the returned iterator will be equal to
+     * `end()`.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the first entity that has the given components.
+     */
+    const_iterator_type cbegin() const ENTT_NOEXCEPT {
+        return valid()
+                ? iterator_type{ pools.cbegin() + 1, pools.cend(), extent(), pools.front()->cbegin(), pools.front()->cend() }
+                : cend();
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity that has the given
+     * components.
+     *
+     * The returned iterator points to the first entity that has the given
+     * components. If the view is empty, the returned iterator will be equal to
+     * `end()`.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the first entity that has the given components.
+     */
+    inline const_iterator_type begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity that has the
+     * given components.
+     *
+     * The returned iterator points to the entity following the last entity that
+     * has the given components. Attempting to dereference the returned iterator
+     * results in undefined behavior.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the entity following the last entity that has the
+     * given components.
+     */
+    const_iterator_type cend() const ENTT_NOEXCEPT {
+        // an invalid view has no pool from which to take the iterators
+        const auto last = valid() ? pools.front()->cend() : underlying_iterator_type{nullptr, {}};
+        return iterator_type{ pools.cend(), pools.cend(), size_type{}, last, last };
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity that has the
+     * given components.
+     *
+     * The returned iterator points to the entity following the last entity that
+     * has the given components. Attempting to dereference the returned iterator
+     * results in undefined behavior.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the entity following the last entity that has the
+     * given components.
+     */
+    inline const_iterator_type end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    /**
+     * @brief Checks if a view contains an entity.
+     * @param entity A valid entity identifier.
+     * @return True if the view contains the given entity, false otherwise.
+     */
+    bool contains(const entity_type entity) const ENTT_NOEXCEPT {
+        return valid() && std::all_of(pools.cbegin(), pools.cend(), [entity](const view_type *view) {
+            return view->has(entity) && (view->data()[view->get(entity)] == entity);
+        });
+    }
+
+    /**
+     * @brief Iterates entities and applies the given function object to them.
+     *
+     * The function object is invoked for each entity. It is provided only with
+     * the entity itself. To get the components, users can use the registry
+     * with which the view was built.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        if(valid()) {
+            const auto ext = extent();
+            const auto first = pools.cbegin() + 1;
+            const auto last = pools.cend();
+
+            std::for_each(pools.front()->cbegin(), pools.front()->cend(), [&func, ext, first, last](const entity_type entity) {
+                const auto sz = size_type(entity & traits_type::entity_mask);
+
+                if(sz < ext && std::all_of(first, last, [entity](const view_type *view) { return view->fast(entity); })) {
+                    func(entity);
+                }
+            });
+        }
+    }
+
+private:
+    pattern_type pools;
+};
+
+
 }
 
 
@@ -1,13 +1,20 @@
 #include "core/algorithm.hpp"
+#include "core/executor.hpp"
 #include "core/family.hpp"
 #include "core/hashed_string.hpp"
 #include "core/ident.hpp"
+#include "core/memory.hpp"
 #include "entity/actor.hpp"
+#include "entity/archive.hpp"
+#include "entity/command_buffer.hpp"
+#include "entity/delta.hpp"
 #include "entity/entt_traits.hpp"
 #include "entity/helper.hpp"
+#include "entity/observer.hpp"
 #include "entity/prototype.hpp"
 #include "entity/registry.hpp"
 #include "entity/snapshot.hpp"
+#include "entity/soa.hpp"
 #include "entity/sparse_set.hpp"
 #include "entity/utility.hpp"
 #include "entity/view.hpp"
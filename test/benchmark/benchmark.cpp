@@ -1,9 +1,49 @@
+#include <new>
+#include <array>
+#include <sstream>
+#include <vector>
 #include <iostream>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #include <chrono>
 #include <gtest/gtest.h>
+#include <entt/core/executor.hpp>
+#include <entt/core/memory.hpp>
+#include <entt/entity/archive.hpp>
+#include <entt/entity/command_buffer.hpp>
+#include <entt/entity/delta.hpp>
 #include <entt/entity/registry.hpp>
+#include <entt/entity/snapshot.hpp>
+#include <entt/entity/sparse_set.hpp>
+
+static std::size_t allocated{};
+
+void * operator new(std::size_t size) {
+    // a header stores the size so that the delete operator can track it
+    auto *ptr = static_cast<std::max_align_t *>(std::malloc(size + sizeof(std::max_align_t)));
+
+    if(!ptr) {
+        throw std::bad_alloc{};
+    }
+
+    *reinterpret_cast<std::size_t *>(ptr) = size;
+    allocated += size;
+
+    return ptr + 1;
+}
+
+void operator delete(void *ptr) noexcept {
+    if(ptr) {
+        auto *header = static_cast<std::max_align_t *>(ptr) - 1;
+        allocated -= *reinterpret_cast<std::size_t *>(header);
+        std::free(header);
+    }
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+    operator delete(ptr);
+}
 
 struct Position {
     std::uint64_t x;
@@ -18,6 +58,39 @@ struct Velocity {
 template<std::size_t>
 struct Comp { int x; };
 
+struct Transform {
+    float x;
+    float y;
+    std::array<float, 14> cold;
+};
+
+struct SoaTransform {
+    float x;
+    float y;
+    std::array<float, 14> cold;
+};
+
+namespace entt {
+
+template<>
+struct soa_traits<SoaTransform> {
+    static auto members() ENTT_NOEXCEPT {
+        return std::make_tuple(&SoaTransform::x, &SoaTransform::y, &SoaTransform::cold);
+    }
+};
+
+}
+
+template<std::size_t>
+struct Marker {};
+
+struct PerElementArchive {
+    // hides the block member function of the binary archive
+    template<typename... Value>
+    void operator()(const Value &... value) { archive(value...); }
+    entt::BinaryOutputArchive &archive;
+};
+
 struct Timer final {
     Timer(): start{std::chrono::system_clock::now()} {}
 
@@ -30,6 +103,41 @@ private:
     std::chrono::time_point<std::chrono::system_clock> start;
 };
 
+template<typename Func>
+void footprint(std::size_t pools, Func func) {
+    using entity_type = typename entt::DefaultRegistry::entity_type;
+    std::vector<std::vector<entity_type>> entities(pools);
+    std::vector<entt::SparseSet<entity_type>> sets(pools);
+    std::size_t flat{};
+
+    for(std::size_t i = 0; i < pools; ++i) {
+        entity_type last{};
+
+        func(i, [&entities, &last, i](entity_type entity) {
+            entities[i].push_back(entity);
+            last = std::max(last, entity);
+        });
+
+        // the flat sparse array was as large as the greatest identifier within the set
+        flat += (last + 1) * sizeof(entity_type);
+
+        // packed arrays aren't affected, keep them out of the count
+        sets[i].reserve(entities[i].size());
+    }
+
+    const auto before = allocated;
+
+    for(std::size_t i = 0; i < pools; ++i) {
+        for(auto entity: entities[i]) {
+            sets[i].construct(entity);
+        }
+    }
+
+    const auto paged = allocated - before;
+
+    std::cout << "sparse arrays: " << paged << " bytes (paged) vs " << flat << " bytes (flat)" << std::endl;
+}
+
 TEST(Benchmark, Construct) {
     entt::DefaultRegistry registry;
 
@@ -41,16 +149,418 @@ TEST(Benchmark, Construct) {
         registry.create();
     }
 
-    timer.elapsed();
+    timer.elapsed();
+}
+
+TEST(Benchmark, ConstructArena) {
+    entt::MonotonicResource arena;
+    entt::DefaultRegistry registry{&arena};
+
+    std::cout << "Constructing 1000000 entities in an arena" << std::endl;
+
+    Timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        registry.create();
+    }
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, ConstructAndDropRegistries) {
+    std::cout << "Constructing and dropping 100 registries of 10000 entities with 3 components" << std::endl;
+
+    auto populate = [](auto &registry) {
+        for(std::uint64_t i = 0; i < 10000L; i++) {
+            const auto entity = registry.create();
+            registry.template assign<Position>(entity);
+            registry.template assign<Velocity>(entity);
+            registry.template assign<Comp<0>>(entity);
+        }
+    };
+
+    Timer timer;
+
+    for(auto i = 0; i < 100; ++i) {
+        entt::DefaultRegistry registry;
+        populate(registry);
+    }
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, ConstructAndDropRegistriesArena) {
+    std::cout << "Constructing and dropping 100 registries of 10000 entities with 3 components in an arena" << std::endl;
+
+    auto populate = [](auto &registry) {
+        for(std::uint64_t i = 0; i < 10000L; i++) {
+            const auto entity = registry.create();
+            registry.template assign<Position>(entity);
+            registry.template assign<Velocity>(entity);
+            registry.template assign<Comp<0>>(entity);
+        }
+    };
+
+    entt::MonotonicResource arena;
+    Timer timer;
+
+    for(auto i = 0; i < 100; ++i) {
+        {
+            entt::DefaultRegistry registry{&arena};
+            populate(registry);
+        }
+
+        arena.release();
+    }
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, CreateMany) {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(1000000);
+
+    std::cout << "Creating 1000000 entities at once" << std::endl;
+
+    Timer timer;
+
+    registry.create(entities.begin(), entities.end());
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, ConstructMany) {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(1000000);
+
+    std::cout << "Constructing 1000000 entities at once" << std::endl;
+
+    for(auto &&entity: entities) {
+        entity = registry.create();
+    }
+
+    Timer timer;
+
+    registry.assign<Position>(entities.cbegin(), entities.cend());
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, ConstructOneByOne) {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(1000000);
+
+    std::cout << "Constructing 1000000 entities one at a time" << std::endl;
+
+    for(auto &&entity: entities) {
+        entity = registry.create();
+    }
+
+    Timer timer;
+
+    for(auto entity: entities) {
+        registry.assign<Position>(entity);
+    }
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, ReplaceVsPatch) {
+    struct Large { std::uint64_t value; char padding[192]; };
+
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(1000000);
+
+    std::cout << "Updating a field of 1000000 components of 200 bytes, replace vs patch" << std::endl;
+
+    for(auto &&entity: entities) {
+        entity = registry.create();
+        registry.assign<Large>(entity);
+    }
+
+    auto test = [&registry, &entities](auto func) {
+        Timer timer;
+
+        for(auto entity: entities) {
+            func(entity);
+        }
+
+        timer.elapsed();
+    };
+
+    test([&registry](auto entity) { registry.replace<Large>(entity, registry.get<Large>(entity).value + 1); });
+    test([&registry](auto entity) { registry.patch<Large>(entity, [](auto &large) { ++large.value; }); });
+}
+
+TEST(Benchmark, SnapshotPerElementVsBlock) {
+    entt::DefaultRegistry registry;
+
+    std::cout << "Saving 1000000 entities, two components, per element vs block" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity);
+        registry.assign<Velocity>(entity);
+    }
+
+    auto test = [&registry](auto func) {
+        std::stringstream stream;
+        entt::BinaryOutputArchive archive{stream};
+        Timer timer;
+        func(archive);
+        timer.elapsed();
+    };
+
+    test([&registry](entt::BinaryOutputArchive &archive) {
+        PerElementArchive output{archive};
+        registry.snapshot().entities(output).component<Position, Velocity>(output);
+    });
+
+    test([&registry](entt::BinaryOutputArchive &archive) {
+        registry.snapshot().entities(archive).component<Position, Velocity>(archive);
+    });
+}
+
+TEST(Benchmark, SnapshotRange) {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(1000000);
+
+    std::cout << "Saving a range of 1000000 entities, three components, per element and block" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity);
+        registry.assign<Comp<0>>(entity);
+
+        if(i % 2) {
+            registry.assign<Velocity>(entity);
+        }
+
+        entities[i] = entity;
+    }
+
+    auto test = [&registry, &entities](auto &archive) {
+        Timer timer;
+        registry.snapshot().component<Position, Velocity, Comp<0>>(archive, entities.cbegin(), entities.cend());
+        timer.elapsed();
+    };
+
+    std::stringstream stream;
+    entt::BinaryOutputArchive archive{stream};
+    PerElementArchive output{archive};
+
+    test(output);
+    test(archive);
+}
+
+TEST(Benchmark, SnapshotRestore) {
+    entt::DefaultRegistry registry;
+
+    std::cout << "Restoring 1000000 entities, two components, stream vs memory" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity);
+        registry.assign<Velocity>(entity);
+    }
+
+    std::stringstream stream;
+    entt::BinaryOutputArchive output{stream};
+    registry.snapshot().entities(output).destroyed(output).component<Position, Velocity>(output);
+    const auto buffer = stream.str();
+
+    auto test = [&registry](auto &archive) {
+        Timer timer;
+        registry.restore().entities(archive).destroyed(archive).template component<Position, Velocity>(archive);
+        timer.elapsed();
+    };
+
+    entt::BinaryInputArchive input{stream};
+    test(input);
+
+    entt::MemoryInputArchive memory{buffer.data(), buffer.size()};
+    test(memory);
+}
+
+TEST(Benchmark, SnapshotVsDelta) {
+    entt::DefaultRegistry registry;
+    entt::DefaultDelta delta{registry};
+    std::vector<entt::DefaultRegistry::entity_type> entities(1000000);
+
+    std::cout << "Saving 1000000 entities, two components, 1% changed, snapshot vs delta" << std::endl;
+
+    delta.connect<Position, Velocity>();
+
+    for(auto &&entity: entities) {
+        entity = registry.create();
+        registry.assign<Position>(entity);
+        registry.assign<Velocity>(entity);
+    }
+
+    delta.clear();
+
+    for(std::size_t pos = 0; pos < entities.size(); pos += 100) {
+        registry.patch<Position>(entities[pos], [](auto &position) { ++position.x; });
+    }
+
+    auto test = [](auto func) {
+        std::stringstream stream;
+        entt::BinaryOutputArchive archive{stream};
+        Timer timer;
+        func(archive);
+        timer.elapsed();
+        std::cout << stream.str().size() << " bytes" << std::endl;
+    };
+
+    test([&registry](entt::BinaryOutputArchive &archive) {
+        registry.snapshot().entities(archive).destroyed(archive).component<Position, Velocity>(archive);
+    });
+
+    test([&delta](entt::BinaryOutputArchive &archive) {
+        delta.entities(archive).destroyed(archive).component<Position, Velocity>(archive);
+    });
+}
+
+TEST(Benchmark, ContinuousLoader) {
+    entt::DefaultRegistry src;
+    entt::DefaultRegistry dst;
+    entt::ContinuousLoader<entt::DefaultRegistry::entity_type> loader{dst};
+
+    std::cout << "Restoring 1000000 entities, one component, through a continuous loader" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        src.assign<Position>(src.create());
+    }
+
+    auto test = [&src, &loader]() {
+        std::stringstream stream;
+        entt::BinaryOutputArchive output{stream};
+        entt::BinaryInputArchive input{stream};
+        src.snapshot().entities(output).destroyed(output).component<Position>(output);
+
+        Timer timer;
+        loader.entities(input).destroyed(input).component<Position>(input).shrink();
+        timer.elapsed();
+    };
+
+    // the first run creates local counterparts, the second one reuses them
+    test();
+    test();
+}
+
+TEST(Benchmark, Destroy) {
+    entt::DefaultRegistry registry;
+
+    std::cout << "Destroying 1000000 entities" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        registry.create();
+    }
+
+    Timer timer;
+
+    registry.each([&registry](auto entity) {
+        registry.destroy(entity);
+    });
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, DestroyEmptyComponents) {
+    entt::DefaultRegistry registry;
+
+    std::cout << "Destroying 1000000 entities with 4 empty components" << std::endl;
+
+    const auto before = allocated;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Marker<0>>(entity);
+        registry.assign<Marker<1>>(entity);
+        registry.assign<Marker<2>>(entity);
+        registry.assign<Marker<3>>(entity);
+    }
+
+    std::cout << (allocated - before) << " bytes allocated" << std::endl;
+
+    Timer timer;
+
+    registry.each([&registry](auto entity) {
+        registry.destroy(entity);
+    });
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, CommandBufferPlayback) {
+    entt::DefaultRegistry registry;
+    entt::DefaultCommandBuffer buffer;
+
+    std::cout << "Playing back 500000 entities, two components and 250000 destructions" << std::endl;
+
+    for(std::uint64_t i = 0; i < 500000L; i++) {
+        const auto entity = registry.create();
+
+        if(i % 2) {
+            buffer.destroy(entity);
+        }
+    }
+
+    for(std::uint64_t i = 0; i < 500000L; i++) {
+        const auto placeholder = buffer.create();
+        buffer.assign<Position>(placeholder, i, i);
+        buffer.assign<Velocity>(placeholder, i, i);
+    }
+
+    Timer timer;
+    buffer.playback(registry);
+    timer.elapsed();
+}
+
+TEST(Benchmark, MemoryFootprintSingle) {
+    std::cout << "Memory footprint of a set with a single entity (900000)" << std::endl;
+
+    footprint(1, [](auto, auto construct) {
+        construct(900000);
+    });
+}
+
+TEST(Benchmark, MemoryFootprintSparse) {
+    std::cout << "Memory footprint of 200 sets with 1000 entities each (clustered over 1000000)" << std::endl;
+
+    footprint(200, [](auto pool, auto construct) {
+        for(std::uint32_t i = 0; i < 1000; ++i) {
+            construct(pool * 5000 + i);
+        }
+    });
+}
+
+TEST(Benchmark, MemoryFootprintDense) {
+    std::cout << "Memory footprint of a set with 1000000 entities" << std::endl;
+
+    footprint(1, [](auto, auto construct) {
+        for(std::uint32_t i = 0; i < 1000000; ++i) {
+            construct(i);
+        }
+    });
 }
 
-TEST(Benchmark, Destroy) {
+template<std::size_t... Indexes>
+void destroyManyTypes(bool signatures, std::index_sequence<Indexes...>) {
     entt::DefaultRegistry registry;
+    registry.signatures(signatures);
 
-    std::cout << "Destroying 1000000 entities" << std::endl;
+    std::cout << "Destroying 100000 entities, " << sizeof...(Indexes) << " types of components, signatures ";
+    std::cout << (signatures ? "enabled" : "disabled") << std::endl;
 
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        registry.create();
+    using accumulator_type = int[];
+    accumulator_type pools = { (registry.reserve<Comp<Indexes>>(0), 0)... };
+    (void)pools;
+
+    for(std::uint64_t i = 0; i < 100000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Comp<0>>(entity);
+        registry.assign<Comp<sizeof...(Indexes) - 1>>(entity);
     }
 
     Timer timer;
@@ -62,6 +572,14 @@ TEST(Benchmark, Destroy) {
     timer.elapsed();
 }
 
+TEST(Benchmark, DestroyManyTypes) {
+    destroyManyTypes(false, std::make_index_sequence<300>{});
+}
+
+TEST(Benchmark, DestroyManyTypesSignatures) {
+    destroyManyTypes(true, std::make_index_sequence<300>{});
+}
+
 TEST(Benchmark, IterateCreateDeleteSingleComponent) {
     entt::DefaultRegistry registry;
 
@@ -135,6 +653,79 @@ TEST(Benchmark, IterateSingleComponentRaw1M) {
     });
 }
 
+TEST(Benchmark, IterateSingleComponentChunked1M) {
+    entt::DefaultRegistry registry;
+
+    std::cout << "Iterating over 1000000 entities, one component, position update" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, i, i);
+    }
+
+    auto view = registry.view<Position>();
+
+    Timer each;
+    view.each([](auto, auto &position) { position.x += position.y; });
+    std::cout << "each: ";
+    each.elapsed();
+
+    Timer chunked;
+
+    view.each_chunk([](auto, auto *position, const auto count) {
+        for(std::size_t pos = 0; pos < count; ++pos) {
+            position[pos].x += position[pos].y;
+        }
+    });
+
+    std::cout << "each_chunk: ";
+    chunked.elapsed();
+
+    Timer raw;
+
+    registry.view<Position>(entt::raw_t{}).each_chunk([](auto *position, const auto count) {
+        for(std::size_t pos = 0; pos < count; ++pos) {
+            position[pos].x += position[pos].y;
+        }
+    });
+
+    std::cout << "each_chunk (raw view): ";
+    raw.elapsed();
+}
+
+TEST(Benchmark, IterateHotFieldsRaw1M) {
+    entt::DefaultRegistry registry;
+
+    std::cout << "Iterating over 1000000 entities, two hot fields of a large component, raw access" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Transform>(entity, 1.f, 2.f);
+        registry.assign<SoaTransform>(entity, 1.f, 2.f);
+    }
+
+    Timer aos;
+    auto *transform = registry.raw<Transform>();
+
+    for(auto pos = registry.size<Transform>(); pos; --pos, ++transform) {
+        transform->x += transform->y;
+    }
+
+    std::cout << "array of structures: ";
+    aos.elapsed();
+
+    Timer soa;
+    auto *x = registry.raw<SoaTransform>().get<0>();
+    const auto *y = registry.raw<SoaTransform>().get<1>();
+
+    for(auto pos = registry.size<SoaTransform>(); pos; --pos) {
+        x[pos-1] += y[pos-1];
+    }
+
+    std::cout << "structure of arrays: ";
+    soa.elapsed();
+}
+
 TEST(Benchmark, IterateTwoComponents1M) {
     entt::DefaultRegistry registry;
 
@@ -160,6 +751,32 @@ TEST(Benchmark, IterateTwoComponents1M) {
     });
 }
 
+TEST(Benchmark, IterateTwoComponentsParallel1M) {
+    entt::DefaultRegistry registry;
+    entt::ThreadPool executor;
+
+    std::cout << "Iterating over 1000000 entities, two components, parallel (" << (executor.size() + 1) << " threads)" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity);
+        registry.assign<Velocity>(entity);
+    }
+
+    auto test = [&registry, &executor](auto func) {
+        Timer timer;
+        registry.view<Position, Velocity>().par_each(executor, func);
+        timer.elapsed();
+    };
+
+    test([](auto, const auto &...) {});
+    test([](auto, auto &... comp) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (comp.x = {}, 0)... };
+        (void)accumulator;
+    });
+}
+
 TEST(Benchmark, IterateTwoComponents1MHalf) {
     entt::DefaultRegistry registry;
 
@@ -188,6 +805,65 @@ TEST(Benchmark, IterateTwoComponents1MHalf) {
     });
 }
 
+TEST(Benchmark, IterateTwoComponentsExclude1M) {
+    entt::DefaultRegistry registry;
+
+    std::cout << "Iterating over 1000000 entities, two components, half of the entities excluded" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity);
+        registry.assign<Velocity>(entity);
+
+        if(i % 2) {
+            registry.assign<Comp<0>>(entity);
+        }
+    }
+
+    auto test = [&registry](auto func) {
+        Timer timer;
+        registry.view<Position, Velocity>(entt::exclude_t<Comp<0>>{}).each(func);
+        timer.elapsed();
+    };
+
+    test([](auto, const auto &...) {});
+    test([](auto, auto &... comp) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (comp.x = {}, 0)... };
+        (void)accumulator;
+    });
+}
+
+TEST(Benchmark, IterateTwoComponentsPersistentExclude1M) {
+    entt::DefaultRegistry registry;
+    registry.prepare<Position, Velocity>(entt::exclude_t<Comp<0>>{});
+
+    std::cout << "Iterating over 1000000 entities, two components, half of the entities excluded, persistent view" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity);
+        registry.assign<Velocity>(entity);
+
+        if(i % 2) {
+            registry.assign<Comp<0>>(entity);
+        }
+    }
+
+    auto test = [&registry](auto func) {
+        Timer timer;
+        registry.view<Position, Velocity>(entt::persistent_t{}, entt::exclude_t<Comp<0>>{}).each(func);
+        timer.elapsed();
+    };
+
+    test([](auto, const auto &...) {});
+    test([](auto, auto &... comp) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (comp.x = {}, 0)... };
+        (void)accumulator;
+    });
+}
+
 TEST(Benchmark, IterateTwoComponents1MOne) {
     entt::DefaultRegistry registry;
 
@@ -242,6 +918,32 @@ TEST(Benchmark, IterateTwoComponentsPersistent1M) {
     });
 }
 
+TEST(Benchmark, IterateTwoComponentsGroup1M) {
+    entt::DefaultRegistry registry;
+    registry.prepare<Position, Velocity>(entt::group_t{});
+
+    std::cout << "Iterating over 1000000 entities, two components, group" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity);
+        registry.assign<Velocity>(entity);
+    }
+
+    auto test = [&registry](auto func) {
+        Timer timer;
+        registry.view<Position, Velocity>(entt::group_t{}).each(func);
+        timer.elapsed();
+    };
+
+    test([](auto, const auto &...) {});
+    test([](auto, auto &... comp) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (comp.x = {}, 0)... };
+        (void)accumulator;
+    });
+}
+
 TEST(Benchmark, IterateFiveComponents1M) {
     entt::DefaultRegistry registry;
 
@@ -301,6 +1003,42 @@ TEST(Benchmark, IterateFiveComponents1MHalf) {
     });
 }
 
+TEST(Benchmark, IterateFiveComponents1MHalfShuffled) {
+    entt::DefaultRegistry registry;
+    std::uint64_t seed = 42;
+
+    std::cout << "Iterating over 1000000 entities, five components, half of the entities have all the components, random order" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        const auto entity = registry.create();
+        registry.assign<Velocity>(entity);
+        registry.assign<Comp<1>>(entity);
+        registry.assign<Comp<2>>(entity);
+        registry.assign<Comp<3>>(entity);
+
+        if(i % 2) {
+            registry.assign<Position>(entity, seed >> 32, i);
+        }
+    }
+
+    // the pivot is visited in random order, lookups into the other pools are scattered
+    registry.sort<Position>([](const auto &lhs, const auto &rhs) { return lhs.x < rhs.x; });
+
+    auto test = [&registry](auto func) {
+        Timer timer;
+        registry.view<Position, Velocity, Comp<1>, Comp<2>, Comp<3>>().each(func);
+        timer.elapsed();
+    };
+
+    test([](auto, const auto &...) {});
+    test([](auto, auto &... comp) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (comp.x = {}, 0)... };
+        (void)accumulator;
+    });
+}
+
 TEST(Benchmark, IterateFiveComponents1MOne) {
     entt::DefaultRegistry registry;
 
@@ -361,6 +1099,35 @@ TEST(Benchmark, IterateFiveComponentsPersistent1M) {
     });
 }
 
+TEST(Benchmark, IterateFiveComponentsGroup1M) {
+    entt::DefaultRegistry registry;
+    registry.prepare<Position, Velocity, Comp<1>, Comp<2>, Comp<3>>(entt::group_t{});
+
+    std::cout << "Iterating over 1000000 entities, five components, group" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity);
+        registry.assign<Velocity>(entity);
+        registry.assign<Comp<1>>(entity);
+        registry.assign<Comp<2>>(entity);
+        registry.assign<Comp<3>>(entity);
+    }
+
+    auto test = [&registry](auto func) {
+        Timer timer;
+        registry.view<Position, Velocity, Comp<1>, Comp<2>, Comp<3>>(entt::group_t{}).each(func);
+        timer.elapsed();
+    };
+
+    test([](auto, const auto &...) {});
+    test([](auto, auto &... comp) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (comp.x = {}, 0)... };
+        (void)accumulator;
+    });
+}
+
 TEST(Benchmark, IterateTenComponents1M) {
     entt::DefaultRegistry registry;
 
@@ -541,6 +1308,89 @@ TEST(Benchmark, SortMulti) {
     timer.elapsed();
 }
 
+TEST(Benchmark, SortSingleRadix) {
+    entt::DefaultRegistry registry;
+
+    std::cout << "Sort 150000 entities, one component, radix sort" << std::endl;
+
+    for(std::uint64_t i = 0; i < 150000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, i, i);
+    }
+
+    Timer timer;
+
+    registry.sort<Position>([](const auto &position) {
+        return position.x;
+    }, entt::RadixSort<8, 32>{});
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, SortMultiRadix) {
+    entt::DefaultRegistry registry;
+
+    std::cout << "Sort 150000 entities, two components, radix sort and respect" << std::endl;
+
+    for(std::uint64_t i = 0; i < 150000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, i, i);
+        registry.assign<Velocity>(entity, i, i);
+    }
+
+    Timer timer;
+
+    registry.sort<Position>([](const auto &position) {
+        return position.x;
+    }, entt::RadixSort<8, 32>{});
+
+    registry.sort<Velocity, Position>();
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, SortRandomKeysStdSort) {
+    entt::DefaultRegistry registry;
+    std::uint64_t seed = 42;
+
+    std::cout << "Sort 400000 entities, random 32 bit keys, std::sort" << std::endl;
+
+    for(std::uint64_t i = 0; i < 400000L; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, seed >> 32, i);
+    }
+
+    Timer timer;
+
+    registry.sort<Position>([](const auto &lhs, const auto &rhs) {
+        return lhs.x < rhs.x;
+    });
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, SortRandomKeysRadix) {
+    entt::DefaultRegistry registry;
+    std::uint64_t seed = 42;
+
+    std::cout << "Sort 400000 entities, random 32 bit keys, radix sort" << std::endl;
+
+    for(std::uint64_t i = 0; i < 400000L; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, seed >> 32, i);
+    }
+
+    Timer timer;
+
+    registry.sort<Position>([](const auto &position) {
+        return position.x;
+    }, entt::RadixSort<8, 32>{});
+
+    timer.elapsed();
+}
+
 TEST(Benchmark, AlmostSortedStdSort) {
     entt::DefaultRegistry registry;
     entt::DefaultRegistry::entity_type entities[3];
@@ -24,3 +24,36 @@ TEST(Algorithm, InsertionSort) {
         ASSERT_LT(arr[i], arr[i+1]);
     }
 }
+
+TEST(Algorithm, RadixSort) {
+    std::array<unsigned int, 5> arr{{4, 1, 3, 2, 0}};
+    entt::RadixSort<8, 32> sort;
+
+    sort(arr.begin(), arr.end(), [](const auto &value) {
+        return value;
+    });
+
+    for(auto i = 0; i < 4; ++i) {
+        ASSERT_LT(arr[i], arr[i+1]);
+    }
+}
+
+TEST(Algorithm, RadixSortBoxed) {
+    struct Boxed { unsigned int value; int order; };
+    std::array<Boxed, 6> arr{{{4u, 0}, {1u, 1}, {70000u, 2}, {1u, 3}, {0u, 4}, {70000u, 5}}};
+    entt::RadixSort<4, 20> sort;
+
+    sort(arr.rbegin(), arr.rend(), [](const auto &instance) {
+        return instance.value;
+    });
+
+    for(auto i = 0; i < 5; ++i) {
+        ASSERT_GE(arr[i].value, arr[i+1].value);
+    }
+
+    // radix sort is stable
+    ASSERT_EQ(arr[0].order, 2);
+    ASSERT_EQ(arr[1].order, 5);
+    ASSERT_EQ(arr[3].order, 1);
+    ASSERT_EQ(arr[4].order, 3);
+}
@@ -0,0 +1,46 @@
+#include <atomic>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/executor.hpp>
+
+TEST(ThreadPool, Functionalities) {
+    entt::ThreadPool executor{3};
+    std::vector<int> jobs(1024, 0);
+
+    ASSERT_EQ(executor.size(), 3u);
+
+    for(auto i = 0; i < 10; ++i) {
+        executor(jobs.size(), [&jobs](std::size_t pos) { ++jobs[pos]; });
+    }
+
+    for(auto &&job: jobs) {
+        ASSERT_EQ(job, 10);
+    }
+
+    std::atomic<int> cnt{0};
+    executor(0, [&cnt](std::size_t) { ++cnt; });
+
+    ASSERT_EQ(cnt, 0);
+}
+
+TEST(ThreadPool, NoWorkers) {
+    entt::ThreadPool executor{0};
+    std::size_t cnt{};
+
+    ASSERT_EQ(executor.size(), 0u);
+
+    executor(42, [&cnt](std::size_t pos) { ASSERT_EQ(pos, cnt++); });
+
+    ASSERT_EQ(cnt, 42u);
+}
+
+TEST(ThreadPool, Default) {
+    std::atomic<std::size_t> cnt{0};
+
+    {
+        entt::ThreadPool executor;
+        executor(42, [&cnt](std::size_t) { ++cnt; });
+    }
+
+    ASSERT_EQ(cnt, 42u);
+}
@@ -0,0 +1,146 @@
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <entt/core/memory.hpp>
+
+struct CountingResource final: entt::MemoryResource {
+    std::size_t allocated{};
+    std::size_t deallocated{};
+
+private:
+    void * do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocated;
+        return entt::default_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) override {
+        ++deallocated;
+        entt::default_resource()->deallocate(ptr, bytes, alignment);
+    }
+};
+
+struct Base {
+    virtual ~Base() = default;
+};
+
+struct Derived: Base {
+    Derived(int &counter): counter{counter} {}
+    ~Derived() { ++counter; }
+    int &counter;
+    std::uint64_t padding[4];
+};
+
+struct alignas(64) OverAligned {
+    unsigned char data[64];
+};
+
+TEST(Memory, DefaultResource) {
+    auto *resource = entt::default_resource();
+
+    ASSERT_EQ(resource, entt::default_resource());
+    ASSERT_TRUE(resource->is_equal(*entt::default_resource()));
+
+    void *ptr = resource->allocate(128u, 64u);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % 64u, 0u);
+
+    resource->deallocate(ptr, 128u, 64u);
+}
+
+TEST(Memory, Allocator) {
+    CountingResource resource;
+    std::vector<int, entt::Allocator<int>> vec{entt::Allocator<int>{&resource}};
+
+    ASSERT_EQ(vec.get_allocator().resource(), &resource);
+    ASSERT_EQ(vec.get_allocator(), entt::Allocator<char>{&resource});
+    ASSERT_NE(vec.get_allocator(), entt::Allocator<int>{});
+
+    vec.reserve(42u);
+    vec.push_back(3);
+
+    ASSERT_EQ(resource.allocated, 1u);
+    ASSERT_EQ(resource.deallocated, 0u);
+
+    vec = {};
+    vec.shrink_to_fit();
+
+    ASSERT_EQ(resource.deallocated, 1u);
+
+    std::vector<OverAligned, entt::Allocator<OverAligned>> aligned(3u);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(aligned.data()) % 64u, 0u);
+}
+
+TEST(Memory, AlignedAllocator) {
+    CountingResource resource;
+    std::vector<float, entt::AlignedAllocator<float, 64>> vec{entt::Allocator<float>{&resource}};
+
+    ASSERT_EQ(vec.get_allocator().resource(), &resource);
+    ASSERT_EQ(vec.get_allocator(), entt::Allocator<int>{&resource});
+
+    for(auto i = 0; i < 42; ++i) {
+        vec.push_back(float(i));
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(vec.data()) % 64u, 0u);
+    }
+
+    std::vector<OverAligned, entt::AlignedAllocator<OverAligned, 16>> aligned(3u);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(aligned.data()) % 64u, 0u);
+}
+
+TEST(Memory, MonotonicResource) {
+    CountingResource upstream;
+    entt::MonotonicResource resource{&upstream, 64u};
+
+    ASSERT_EQ(resource.upstream_resource(), &upstream);
+
+    void *first = resource.allocate(8u, 8u);
+    void *second = resource.allocate(8u, 8u);
+
+    ASSERT_EQ(upstream.allocated, 1u);
+    ASSERT_EQ(static_cast<unsigned char *>(second) - static_cast<unsigned char *>(first), 8);
+
+    resource.deallocate(first, 8u, 8u);
+    resource.deallocate(second, 8u, 8u);
+
+    ASSERT_EQ(upstream.deallocated, 0u);
+
+    void *aligned = resource.allocate(256u, 64u);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 64u, 0u);
+    ASSERT_EQ(upstream.allocated, 2u);
+
+    resource.release();
+
+    ASSERT_EQ(upstream.deallocated, 2u);
+
+    resource.allocate(8u, 8u);
+
+    ASSERT_EQ(upstream.allocated, 3u);
+}
+
+TEST(Memory, AllocateUnique) {
+    CountingResource resource;
+    int counter{};
+
+    {
+        entt::ResourcePtr<Base> ptr = entt::allocate_unique<Derived>(&resource, counter);
+
+        ASSERT_NE(ptr, nullptr);
+        ASSERT_EQ(resource.allocated, 1u);
+    }
+
+    ASSERT_EQ(counter, 1);
+    ASSERT_EQ(resource.deallocated, 1u);
+
+    {
+        auto ptr = entt::allocate_unique<int[]>(&resource, 16u);
+
+        ASSERT_EQ(ptr[0], 0);
+        ASSERT_EQ(ptr[15], 0);
+        ASSERT_EQ(resource.allocated, 2u);
+    }
+
+    ASSERT_EQ(resource.deallocated, 2u);
+}
@@ -0,0 +1,298 @@
+#include <sstream>
+#include <gtest/gtest.h>
+#include <entt/entity/archive.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/snapshot.hpp>
+
+struct Position {
+    float x;
+    float y;
+};
+
+struct Relationship {
+    entt::DefaultRegistry::entity_type parent;
+};
+
+struct Empty {};
+
+template<typename Archive>
+struct CountingArchive {
+    CountingArchive(Archive &archive)
+        : archive{archive}
+    {}
+
+    template<typename... Value>
+    void operator()(Value &&... value) {
+        archive(value...);
+    }
+
+    template<typename Type>
+    void block(Type *data, const std::size_t count) {
+        archive.block(data, count);
+        ++blocks;
+    }
+
+    Archive &archive;
+    std::size_t blocks{};
+};
+
+TEST(Archive, Values) {
+    std::stringstream stream;
+    entt::BinaryOutputArchive output{stream};
+    entt::BinaryInputArchive input{stream};
+
+    const int values[] = { 1, 2, 3 };
+    output(42, 'c', Position{.1f, .2f});
+    output.block(values, 3);
+
+    int ivalue{};
+    char cvalue{};
+    Position position{};
+    int other[3]{};
+
+    input(ivalue, cvalue, position);
+    input.block(other, 3);
+
+    ASSERT_EQ(ivalue, 42);
+    ASSERT_EQ(cvalue, 'c');
+    ASSERT_EQ(position.x, .1f);
+    ASSERT_EQ(position.y, .2f);
+    ASSERT_EQ(other[0], 1);
+    ASSERT_EQ(other[1], 2);
+    ASSERT_EQ(other[2], 3);
+}
+
+TEST(Archive, Snapshot) {
+    entt::DefaultRegistry registry;
+
+    const auto e0 = registry.create();
+    registry.assign<Position>(e0, 1.f, 2.f);
+    registry.assign<char>(e0, 'c');
+    registry.assign<Empty>(e0);
+
+    const auto e1 = registry.create();
+    registry.destroy(e1);
+
+    const auto e2 = registry.create();
+    registry.assign<Position>(e2, 5.f, 6.f);
+    registry.assign<int>(entt::tag_t{}, e2, 42);
+
+    std::stringstream stream;
+    entt::BinaryOutputArchive binary_output{stream};
+    entt::BinaryInputArchive binary_input{stream};
+    CountingArchive<entt::BinaryOutputArchive> output{binary_output};
+    CountingArchive<entt::BinaryInputArchive> input{binary_input};
+
+    registry.snapshot()
+            .entities(output)
+            .destroyed(output)
+            .component<Position, char, Empty>(output)
+            .tag<int>(output);
+
+    // entities and instances of positions and chars, entities of empty components
+    ASSERT_EQ(output.blocks, 5u);
+
+    registry.reset();
+
+    registry.restore()
+            .entities(input)
+            .destroyed(input)
+            .component<Position, char, Empty>(input)
+            .tag<int>(input)
+            .orphans();
+
+    ASSERT_EQ(input.blocks, 5u);
+
+    ASSERT_TRUE(registry.valid(e0));
+    ASSERT_FALSE(registry.valid(e1));
+    ASSERT_TRUE(registry.valid(e2));
+
+    ASSERT_EQ(registry.get<Position>(e0).x, 1.f);
+    ASSERT_EQ(registry.get<Position>(e0).y, 2.f);
+    ASSERT_EQ(registry.get<char>(e0), 'c');
+    ASSERT_TRUE(registry.has<Empty>(e0));
+    ASSERT_EQ(registry.get<Position>(e2).x, 5.f);
+    ASSERT_EQ(registry.get<Position>(e2).y, 6.f);
+    ASSERT_FALSE(registry.has<char>(e2));
+    ASSERT_FALSE(registry.has<Empty>(e2));
+
+    ASSERT_TRUE(registry.has<int>());
+    ASSERT_EQ(registry.attachee<int>(), e2);
+    ASSERT_EQ(registry.get<int>(), 42);
+}
+
+TEST(Archive, Partial) {
+    entt::DefaultRegistry registry;
+
+    const auto e0 = registry.create();
+    registry.assign<Position>(e0, 1.f, 2.f);
+    registry.assign<Empty>(e0);
+
+    const auto e1 = registry.create();
+    registry.assign<Position>(e1, 3.f, 4.f);
+
+    const auto e2 = registry.create();
+    registry.assign<Position>(e2, 5.f, 6.f);
+    registry.assign<Empty>(e2);
+
+    std::stringstream stream;
+    entt::BinaryOutputArchive output{stream};
+    entt::BinaryInputArchive input{stream};
+
+    const entt::DefaultRegistry::entity_type entities[] = { e0, e2 };
+    registry.snapshot().component<Position, Empty>(output, std::begin(entities), std::end(entities));
+
+    registry.reset();
+
+    registry.restore()
+            .component<Position, Empty>(input)
+            .orphans();
+
+    ASSERT_TRUE(registry.valid(e0));
+    ASSERT_FALSE(registry.valid(e1));
+    ASSERT_TRUE(registry.valid(e2));
+
+    ASSERT_EQ(registry.get<Position>(e0).x, 1.f);
+    ASSERT_EQ(registry.get<Position>(e0).y, 2.f);
+    ASSERT_EQ(registry.get<Position>(e2).x, 5.f);
+    ASSERT_EQ(registry.get<Position>(e2).y, 6.f);
+    ASSERT_TRUE(registry.has<Empty>(e0));
+    ASSERT_TRUE(registry.has<Empty>(e2));
+}
+
+TEST(Archive, Continuous) {
+    entt::DefaultRegistry src;
+    entt::DefaultRegistry dst;
+    entt::ContinuousLoader<entt::DefaultRegistry::entity_type> loader{dst};
+
+    // shifts identifiers, so that the loader has to map them
+    dst.create();
+    dst.create();
+
+    const auto parent = src.create();
+    src.assign<Position>(parent, 1.f, 2.f);
+
+    const auto child = src.create();
+    src.assign<Position>(child, 3.f, 4.f);
+    src.assign<Relationship>(child, parent);
+    src.assign<Empty>(child);
+
+    std::stringstream stream;
+    entt::BinaryOutputArchive output{stream};
+    entt::BinaryInputArchive input{stream};
+
+    src.snapshot()
+            .entities(output)
+            .destroyed(output)
+            .component<Position, Relationship, Empty>(output);
+
+    loader.entities(input)
+            .destroyed(input)
+            .component<Position, Relationship, Empty>(input, &Relationship::parent)
+            .orphans();
+
+    ASSERT_TRUE(loader.has(parent));
+    ASSERT_TRUE(loader.has(child));
+
+    const auto lparent = loader.map(parent);
+    const auto lchild = loader.map(child);
+
+    ASSERT_EQ(dst.size<Position>(), 2u);
+    ASSERT_EQ(dst.get<Position>(lparent).x, 1.f);
+    ASSERT_EQ(dst.get<Position>(lchild).y, 4.f);
+    ASSERT_EQ(dst.get<Relationship>(lchild).parent, lparent);
+    ASSERT_TRUE(dst.has<Empty>(lchild));
+    ASSERT_FALSE(dst.has<Empty>(lparent));
+}
+
+TEST(Archive, Memory) {
+    entt::DefaultRegistry registry;
+
+    for(auto i = 0; i < 100; ++i) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, float(i), float(i));
+
+        if(i % 2) {
+            registry.assign<Empty>(entity);
+        }
+
+        if(i % 3) {
+            registry.destroy(entity);
+        }
+    }
+
+    std::stringstream stream;
+    entt::BinaryOutputArchive output{stream};
+
+    registry.snapshot()
+            .entities(output)
+            .destroyed(output)
+            .component<Position, Empty>(output);
+
+    const auto buffer = stream.str();
+    entt::MemoryInputArchive input{buffer.data(), buffer.size()};
+    entt::DefaultRegistry other;
+
+    other.restore()
+            .entities(input)
+            .destroyed(input)
+            .component<Position, Empty>(input)
+            .orphans();
+
+    ASSERT_EQ(input.remaining(), 0u);
+    ASSERT_EQ(other.size(), registry.size());
+    ASSERT_EQ(other.capacity(), registry.capacity());
+    ASSERT_EQ(other.size<Position>(), registry.size<Position>());
+    ASSERT_EQ(other.size<Empty>(), registry.size<Empty>());
+
+    registry.view<Position>().each([&registry, &other](const auto entity, const auto &position) {
+        ASSERT_TRUE(other.valid(entity));
+        ASSERT_EQ(other.get<Position>(entity).x, position.x);
+        ASSERT_EQ(other.has<Empty>(entity), registry.has<Empty>(entity));
+    });
+
+    ASSERT_EQ(other.create(), registry.create());
+}
+
+TEST(Archive, OwnedPool) {
+    entt::DefaultRegistry registry;
+
+    for(auto i = 0; i < 10; ++i) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, float(i), float(i));
+
+        if(i % 2) {
+            registry.assign<char>(entity, char('a' + i));
+        }
+    }
+
+    std::stringstream stream;
+    entt::BinaryOutputArchive output{stream};
+    entt::BinaryInputArchive input{stream};
+
+    registry.snapshot()
+            .entities(output)
+            .destroyed(output)
+            .component<char, Position>(output);
+
+    entt::DefaultRegistry other;
+    const auto loader = other.restore();
+    // restoring resets the registry, groups are prepared in between
+    other.prepare<Position, char>(entt::group_t{});
+
+    loader.entities(input)
+            .destroyed(input)
+            .component<char, Position>(input)
+            .orphans();
+
+    ASSERT_EQ((other.view<Position, char>(entt::group_t{}).size()), 5u);
+
+    registry.view<Position>().each([&registry, &other](const auto entity, const auto &position) {
+        ASSERT_EQ(other.get<Position>(entity).x, position.x);
+        ASSERT_EQ(other.has<char>(entity), registry.has<char>(entity));
+
+        if(registry.has<char>(entity)) {
+            ASSERT_EQ(other.get<char>(entity), registry.get<char>(entity));
+        }
+    });
+}
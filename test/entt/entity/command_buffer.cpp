@@ -0,0 +1,146 @@
+#include <atomic>
+#include <memory>
+#include <gtest/gtest.h>
+#include <entt/core/executor.hpp>
+#include <entt/entity/command_buffer.hpp>
+#include <entt/entity/registry.hpp>
+
+struct Position { int x; int y; };
+struct Velocity { int dx; int dy; };
+struct alignas(64) Aligned { int value; };
+
+TEST(CommandBuffer, Functionalities) {
+    entt::DefaultRegistry registry;
+    entt::DefaultCommandBuffer buffer;
+
+    const auto e0 = registry.create();
+    registry.assign<int>(e0, 0);
+
+    const auto e1 = registry.create();
+    registry.assign<int>(e1, 1);
+    registry.assign<char>(e1, 'c');
+
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_EQ(buffer.size(), entt::DefaultCommandBuffer::size_type{0});
+
+    const auto placeholder = buffer.create();
+    buffer.assign<int>(placeholder, 42);
+    buffer.assign<Position>(placeholder, 1, 2);
+    buffer.replace<int>(e0, 3);
+    buffer.assign<char>(e0, 'a');
+    buffer.remove<char>(e1);
+    buffer.destroy(e1);
+    buffer.destroy(e1);
+
+    ASSERT_FALSE(buffer.empty());
+    ASSERT_EQ(buffer.size(), entt::DefaultCommandBuffer::size_type{8});
+    ASSERT_EQ(registry.get<int>(e0), 0);
+    ASSERT_TRUE(registry.valid(e1));
+
+    buffer.playback(registry);
+
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_FALSE(registry.valid(e1));
+    ASSERT_EQ(registry.get<int>(e0), 3);
+    ASSERT_EQ(registry.get<char>(e0), 'a');
+    ASSERT_EQ(registry.size(), decltype(registry.size()){2});
+
+    registry.view<Position>().each([&registry](const auto entity, const auto &position) {
+        ASSERT_EQ(registry.get<int>(entity), 42);
+        ASSERT_EQ(position.x, 1);
+        ASSERT_EQ(position.y, 2);
+    });
+
+    ASSERT_EQ(registry.view<Position>().size(), decltype(registry.view<Position>().size()){1});
+}
+
+TEST(CommandBuffer, OrderWithinLane) {
+    entt::DefaultRegistry registry;
+    entt::DefaultCommandBuffer buffer;
+    const auto entity = registry.create();
+
+    buffer.assign<int>(entity, 0);
+    buffer.assign<char>(entity, 'c');
+    buffer.replace<int>(entity, 1);
+    buffer.remove<char>(entity);
+    buffer.replace<int>(entity, 2);
+    buffer.playback(registry);
+
+    ASSERT_EQ(registry.get<int>(entity), 2);
+    ASSERT_FALSE(registry.has<char>(entity));
+}
+
+TEST(CommandBuffer, Payloads) {
+    entt::DefaultRegistry registry;
+    entt::DefaultCommandBuffer buffer;
+    auto ptr = std::make_shared<int>(0);
+    const auto entity = registry.create();
+
+    for(auto i = 0; i < 10000; ++i) {
+        buffer.assign<Aligned>(buffer.create(), i);
+    }
+
+    buffer.assign<std::shared_ptr<int>>(entity, ptr);
+
+    ASSERT_EQ(ptr.use_count(), 2);
+
+    buffer.clear();
+
+    ASSERT_EQ(ptr.use_count(), 1);
+    ASSERT_TRUE(buffer.empty());
+
+    for(auto i = 0; i < 10000; ++i) {
+        buffer.assign<Aligned>(buffer.create(), i);
+    }
+
+    buffer.assign<std::shared_ptr<int>>(entity, ptr);
+    buffer.playback(registry);
+
+    ASSERT_EQ(ptr.use_count(), 2);
+    ASSERT_EQ(registry.get<std::shared_ptr<int>>(entity), ptr);
+    ASSERT_EQ(registry.size(), decltype(registry.size()){10001});
+
+    int sum = 0;
+    registry.view<Aligned>().each([&sum](auto, const auto &instance) { sum += instance.value; });
+
+    ASSERT_EQ(sum, 9999 * 10000 / 2);
+}
+
+TEST(CommandBuffer, Concurrent) {
+    entt::DefaultRegistry registry;
+    entt::DefaultCommandBuffer buffer;
+    entt::ThreadPool pool{3};
+
+    for(auto i = 0; i < 10000; ++i) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, i, i);
+        registry.assign<Velocity>(entity, i % 2, 0);
+    }
+
+    registry.view<Position, Velocity>().par_each(pool, [&buffer](const auto entity, const auto &position, const auto &velocity) {
+        if(velocity.dx) {
+            buffer.destroy(entity);
+        } else {
+            const auto placeholder = buffer.create();
+            buffer.assign<Position>(placeholder, position.x, -1);
+            buffer.replace<Velocity>(entity, 1, 1);
+        }
+    });
+
+    ASSERT_EQ(buffer.size(), entt::DefaultCommandBuffer::size_type{20000});
+
+    buffer.playback(registry);
+
+    ASSERT_EQ(registry.size(), decltype(registry.size()){10000});
+    ASSERT_EQ(registry.view<Velocity>().size(), decltype(registry.view<Velocity>().size()){5000});
+
+    registry.view<Position>().each([&registry](const auto entity, const auto &position) {
+        ASSERT_EQ(position.x % 2, 0);
+
+        if(position.y < 0) {
+            ASSERT_FALSE(registry.has<Velocity>(entity));
+        } else {
+            ASSERT_EQ(registry.get<Velocity>(entity).dx, 1);
+        }
+    });
+}
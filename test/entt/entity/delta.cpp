@@ -0,0 +1,280 @@
+#include <tuple>
+#include <queue>
+#include <sstream>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/archive.hpp>
+#include <entt/entity/delta.hpp>
+#include <entt/entity/entt_traits.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/snapshot.hpp>
+
+template<typename Storage>
+struct OutputArchive {
+    OutputArchive(Storage &storage)
+        : storage{storage}
+    {}
+
+    template<typename... Value>
+    void operator()(const Value &... value) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (std::get<std::queue<Value>>(storage).push(value), 0)... };
+        (void)accumulator;
+    }
+
+private:
+    Storage &storage;
+};
+
+template<typename Storage>
+struct InputArchive {
+    InputArchive(Storage &storage)
+        : storage{storage}
+    {}
+
+    template<typename... Value>
+    void operator()(Value &... value) {
+        auto assign = [this](auto &value) {
+            auto &queue = std::get<std::queue<std::decay_t<decltype(value)>>>(storage);
+            value = queue.front();
+            queue.pop();
+        };
+
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (assign(value), 0)... };
+        (void)accumulator;
+    }
+
+private:
+    Storage &storage;
+};
+
+struct Position {
+    int x;
+    int y;
+};
+
+struct Relationship {
+    entt::DefaultRegistry::entity_type parent;
+};
+
+using storage_type = std::tuple<
+    std::queue<entt::DefaultRegistry::entity_type>,
+    std::queue<Position>,
+    std::queue<Relationship>
+>;
+
+TEST(Delta, Functionalities) {
+    entt::DefaultRegistry src;
+    entt::DefaultRegistry dst;
+    entt::DefaultDelta delta{src};
+    entt::ContinuousLoader<entt::DefaultRegistry::entity_type> loader{dst};
+
+    storage_type storage;
+    OutputArchive<storage_type> output{storage};
+    InputArchive<storage_type> input{storage};
+
+    delta.connect<Position, Relationship>();
+
+    ASSERT_TRUE(delta.empty());
+
+    const auto e0 = src.create();
+    src.assign<Position>(e0, 0, 0);
+
+    const auto e1 = src.create();
+    src.assign<Position>(e1, 1, 1);
+    src.assign<Relationship>(e1, e0);
+
+    const auto e2 = src.create();
+    src.assign<Position>(e2, 2, 2);
+
+    ASSERT_FALSE(delta.empty());
+
+    delta.entities(output).destroyed(output).component<Position, Relationship>(output);
+    loader.entities(input).purge(input).delta<Position, Relationship>(input, &Relationship::parent);
+    delta.clear();
+
+    ASSERT_TRUE(delta.empty());
+    ASSERT_TRUE(loader.has(e0));
+    ASSERT_TRUE(loader.has(e1));
+    ASSERT_TRUE(loader.has(e2));
+    ASSERT_EQ(dst.size<Position>(), 3u);
+    ASSERT_EQ(dst.get<Position>(loader.map(e1)).x, 1);
+    ASSERT_EQ(dst.get<Relationship>(loader.map(e1)).parent, loader.map(e0));
+
+    const auto local = loader.map(e1);
+
+    src.replace<Position>(e0, 42, 42);
+    src.remove<Position>(e2);
+    src.destroy(e1);
+
+    const auto e3 = src.create();
+    src.assign<Relationship>(e3, e0);
+
+    delta.entities(output).destroyed(output).component<Position, Relationship>(output);
+
+    // sizes and identifiers of e0 and e3 changed, e1 destroyed, e2 removed
+    ASSERT_EQ(std::get<0>(storage).size(), 12u);
+    ASSERT_EQ(std::get<1>(storage).size(), 1u);
+    ASSERT_EQ(std::get<2>(storage).size(), 1u);
+
+    loader.entities(input).purge(input).delta<Position, Relationship>(input, &Relationship::parent);
+    delta.clear();
+
+    ASSERT_TRUE(std::get<0>(storage).empty());
+    ASSERT_FALSE(loader.has(e1));
+    ASSERT_FALSE(dst.valid(local));
+    ASSERT_TRUE(loader.has(e3));
+
+    ASSERT_EQ(dst.size<Position>(), 1u);
+    ASSERT_EQ(dst.get<Position>(loader.map(e0)).x, 42);
+    ASSERT_TRUE(dst.valid(loader.map(e2)));
+    ASSERT_FALSE(dst.has<Position>(loader.map(e2)));
+    ASSERT_EQ(dst.size<Relationship>(), 1u);
+    ASSERT_EQ(dst.get<Relationship>(loader.map(e3)).parent, loader.map(e0));
+}
+
+TEST(Delta, RecycledIdentifiers) {
+    entt::DefaultRegistry src;
+    entt::DefaultRegistry dst;
+    entt::DefaultDelta delta{src};
+    entt::ContinuousLoader<entt::DefaultRegistry::entity_type> loader{dst};
+
+    storage_type storage;
+    OutputArchive<storage_type> output{storage};
+    InputArchive<storage_type> input{storage};
+
+    delta.connect<Position>();
+
+    const auto entity = src.create();
+    src.assign<Position>(entity, 1, 1);
+
+    delta.entities(output).destroyed(output).component<Position>(output);
+    loader.entities(input).purge(input).delta<Position>(input);
+    delta.clear();
+
+    const auto local = loader.map(entity);
+    src.destroy(entity);
+    const auto other = src.create();
+    src.assign<Position>(other, 2, 2);
+
+    using traits_type = entt::entt_traits<entt::DefaultRegistry::entity_type>;
+
+    ASSERT_NE(entity, other);
+    ASSERT_EQ(entity & traits_type::entity_mask, other & traits_type::entity_mask);
+
+    delta.entities(output).destroyed(output).component<Position>(output);
+    loader.entities(input).purge(input).delta<Position>(input);
+
+    ASSERT_FALSE(loader.has(entity));
+    ASSERT_FALSE(dst.valid(local));
+    ASSERT_TRUE(loader.has(other));
+    ASSERT_EQ(dst.size<Position>(), 1u);
+    ASSERT_EQ(dst.get<Position>(loader.map(other)).x, 2);
+}
+
+TEST(Delta, MissedDestruction) {
+    entt::DefaultRegistry src;
+    entt::DefaultRegistry dst;
+    entt::DefaultDelta delta{src};
+    entt::ContinuousLoader<entt::DefaultRegistry::entity_type> loader{dst};
+
+    storage_type storage;
+    OutputArchive<storage_type> output{storage};
+    InputArchive<storage_type> input{storage};
+
+    delta.connect<Position>();
+
+    auto entity = src.create();
+    src.assign<Position>(entity, 0, 0);
+
+    delta.entities(output).destroyed(output).component<Position>(output);
+    loader.entities(input).purge(input).delta<Position>(input);
+    delta.clear();
+
+    const auto first = entity;
+    const auto local = loader.map(entity);
+
+    for(auto i = 0; i < 3; ++i) {
+        // entities without observed components are destroyed silently
+        src.remove<Position>(entity);
+        delta.clear();
+        src.destroy(entity);
+
+        entity = src.create();
+        src.assign<Position>(entity, i, i);
+
+        delta.entities(output).destroyed(output).component<Position>(output);
+        loader.entities(input).purge(input).delta<Position>(input);
+        delta.clear();
+    }
+
+    ASSERT_TRUE(loader.has(entity));
+    ASSERT_FALSE(loader.has(first));
+    ASSERT_FALSE(dst.valid(local));
+    ASSERT_EQ(dst.size(), 2u);
+
+    loader.prune();
+
+    ASSERT_TRUE(loader.has(entity));
+    ASSERT_EQ(dst.size(), 1u);
+    ASSERT_EQ(dst.get<Position>(loader.map(entity)).x, 2);
+}
+
+TEST(Delta, Disconnect) {
+    entt::DefaultRegistry registry;
+    entt::DefaultDelta delta{registry};
+
+    delta.connect<Position>();
+    delta.connect<Position>();
+    registry.assign<Position>(registry.create());
+
+    ASSERT_FALSE(delta.empty());
+
+    delta.clear();
+    delta.disconnect();
+    registry.assign<Position>(registry.create());
+
+    ASSERT_TRUE(delta.empty());
+}
+
+TEST(Delta, BinaryArchive) {
+    entt::DefaultRegistry src;
+    entt::DefaultRegistry dst;
+    entt::DefaultDelta delta{src};
+    entt::ContinuousLoader<entt::DefaultRegistry::entity_type> loader{dst};
+
+    std::stringstream stream;
+    entt::BinaryOutputArchive output{stream};
+    entt::BinaryInputArchive input{stream};
+
+    delta.connect<Position>();
+
+    for(auto i = 0; i < 10; ++i) {
+        src.assign<Position>(src.create(), i, i);
+    }
+
+    delta.entities(output).destroyed(output).component<Position>(output);
+    loader.entities(input).purge(input).delta<Position>(input);
+    delta.clear();
+
+    std::vector<entt::DefaultRegistry::entity_type> entities{src.view<Position>().begin(), src.view<Position>().end()};
+
+    for(const auto entity: entities) {
+        if(src.get<Position>(entity).x % 2) {
+            src.patch<Position>(entity, [](auto &position) { position.y = -1; });
+        } else {
+            src.destroy(entity);
+        }
+    }
+
+    delta.entities(output).destroyed(output).component<Position>(output);
+    loader.entities(input).purge(input).delta<Position>(input);
+
+    ASSERT_EQ(dst.size<Position>(), 5u);
+
+    dst.view<Position>().each([](const auto, const auto &position) {
+        ASSERT_TRUE(position.x % 2);
+        ASSERT_EQ(position.y, -1);
+    });
+}
@@ -0,0 +1,111 @@
+#include <vector>
+#include <iterator>
+#include <gtest/gtest.h>
+#include <entt/entity/observer.hpp>
+#include <entt/entity/registry.hpp>
+
+TEST(Observer, Functionalities) {
+    entt::DefaultRegistry registry;
+    entt::DefaultObserver observer{registry};
+
+    observer.connect<int, char>();
+
+    ASSERT_TRUE(observer.empty());
+    ASSERT_EQ(observer.size(), 0u);
+    ASSERT_EQ(observer.begin(), observer.end());
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+
+    registry.assign<int>(e0);
+    registry.assign<char>(e0);
+    registry.assign<double>(e1);
+
+    ASSERT_FALSE(observer.empty());
+    ASSERT_EQ(observer.size(), 1u);
+    ASSERT_TRUE(observer.contains(e0));
+    ASSERT_FALSE(observer.contains(e1));
+    ASSERT_EQ(*observer.data(), e0);
+
+    observer.clear();
+
+    ASSERT_TRUE(observer.empty());
+    ASSERT_FALSE(observer.contains(e0));
+
+    registry.assign<int>(e2);
+    registry.replace<int>(e0, 42);
+    registry.accommodate<char>(e0, 'c');
+    registry.replace<double>(e1, 0.);
+    registry.patch<double>(e1, [](auto &value) { value = 1.; });
+
+    ASSERT_EQ(observer.size(), 2u);
+    ASSERT_TRUE(observer.contains(e0));
+    ASSERT_TRUE(observer.contains(e2));
+    ASSERT_FALSE(observer.contains(e1));
+
+    std::vector<entt::DefaultRegistry::entity_type> entities;
+    observer.each([&entities](auto entity) { entities.push_back(entity); });
+
+    ASSERT_EQ(entities.size(), 2u);
+    ASSERT_EQ(entities.size(), std::size_t(std::distance(observer.begin(), observer.end())));
+}
+
+TEST(Observer, RemoveAndDestroy) {
+    entt::DefaultRegistry registry;
+    entt::DefaultObserver observer{registry};
+
+    observer.connect<int>();
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+
+    registry.assign<int>(e0);
+    registry.assign<int>(e1);
+
+    ASSERT_EQ(observer.size(), 2u);
+
+    registry.remove<int>(e0);
+    registry.destroy(e1);
+
+    ASSERT_TRUE(observer.empty());
+
+    const auto e2 = registry.create();
+    registry.assign<int>(e0);
+    observer.clear();
+    registry.patch<int>(e0, [](auto &value) { ++value; });
+
+    ASSERT_EQ(observer.size(), 1u);
+    ASSERT_TRUE(observer.contains(e0));
+
+    registry.assign<int>(e2);
+
+    ASSERT_EQ(observer.size(), 2u);
+    ASSERT_TRUE(observer.contains(e2));
+}
+
+TEST(Observer, Disconnect) {
+    entt::DefaultRegistry registry;
+    const auto entity = registry.create();
+
+    {
+        entt::DefaultObserver observer{registry};
+        observer.connect<int>();
+        registry.assign<int>(entity);
+
+        ASSERT_EQ(observer.size(), 1u);
+
+        observer.disconnect();
+        registry.remove<int>(entity);
+
+        ASSERT_EQ(observer.size(), 1u);
+
+        observer.connect<int>();
+    }
+
+    // a destroyed observer must not be notified anymore
+    registry.assign<int>(entity);
+    registry.replace<int>(entity, 1);
+
+    ASSERT_TRUE(registry.has<int>(entity));
+}
@@ -1,11 +1,41 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <functional>
+#include <thread>
+#include <vector>
 #include <type_traits>
 #include <gtest/gtest.h>
 #include <entt/entity/entt_traits.hpp>
 #include <entt/entity/registry.hpp>
 
+struct Velocity {
+    float dx;
+    float dy;
+};
+
+struct Status {
+    int health;
+    bool alive;
+};
+
+namespace entt {
+
+template<>
+struct soa_traits<Velocity> {
+    static auto members() ENTT_NOEXCEPT {
+        return std::make_tuple(&Velocity::dx, &Velocity::dy);
+    }
+};
+
+template<>
+struct soa_traits<Status> {
+    static auto members() ENTT_NOEXCEPT {
+        return std::make_tuple(&Status::health, &Status::alive);
+    }
+};
+
+}
+
 struct Listener {
     template<typename Component>
     void incrComponent(entt::DefaultRegistry &registry, entt::DefaultRegistry::entity_type entity) {
@@ -354,6 +384,34 @@ TEST(DefaultRegistry, CreateDestroyEntities) {
     ASSERT_EQ(registry.current(pre), registry.current(post));
 }
 
+TEST(DefaultRegistry, CreateManyEntitiesAtOnce) {
+    entt::DefaultRegistry registry;
+    entt::DefaultRegistry::entity_type entities[3];
+
+    const auto entity = registry.create();
+    registry.destroy(registry.create());
+    registry.destroy(entity);
+    registry.destroy(registry.create());
+
+    registry.create(std::begin(entities), std::end(entities));
+
+    ASSERT_TRUE(registry.valid(entities[0]));
+    ASSERT_TRUE(registry.valid(entities[1]));
+    ASSERT_TRUE(registry.valid(entities[2]));
+
+    ASSERT_EQ(entities[0] & entt::entt_traits<entt::DefaultRegistry::entity_type>::entity_mask, entt::DefaultRegistry::entity_type{0});
+    ASSERT_EQ(registry.version(entities[0]), entt::DefaultRegistry::version_type{2});
+
+    ASSERT_EQ(entities[1] & entt::entt_traits<entt::DefaultRegistry::entity_type>::entity_mask, entt::DefaultRegistry::entity_type{1});
+    ASSERT_EQ(registry.version(entities[1]), entt::DefaultRegistry::version_type{1});
+
+    ASSERT_EQ(entities[2] & entt::entt_traits<entt::DefaultRegistry::entity_type>::entity_mask, entt::DefaultRegistry::entity_type{2});
+    ASSERT_EQ(registry.version(entities[2]), entt::DefaultRegistry::version_type{0});
+
+    ASSERT_EQ(registry.size(), 3u);
+    ASSERT_EQ(registry.create(), entt::DefaultRegistry::entity_type{3});
+}
+
 TEST(DefaultRegistry, AttachSetRemoveTags) {
     entt::DefaultRegistry registry;
     const auto &cregistry = registry;
@@ -427,6 +485,44 @@ TEST(DefaultRegistry, StandardView) {
     ASSERT_EQ(cnt, decltype(mview)::size_type{2});
 }
 
+TEST(DefaultRegistry, Group) {
+    entt::DefaultRegistry registry;
+
+    ASSERT_FALSE((registry.contains<int, char>(entt::group_t{})));
+
+    const auto e0 = registry.create();
+    registry.assign<int>(e0, 0);
+    registry.assign<char>(e0, 'c');
+
+    const auto e1 = registry.create();
+    registry.assign<int>(e1, 1);
+
+    const auto e2 = registry.create();
+    registry.assign<int>(e2, 2);
+    registry.assign<char>(e2, 'c');
+
+    registry.prepare<int, char>(entt::group_t{});
+
+    ASSERT_TRUE((registry.contains<int, char>(entt::group_t{})));
+    ASSERT_EQ((registry.view<int, char>(entt::group_t{}).size()), decltype(registry.size())(2));
+
+    registry.discard<int, char>(entt::group_t{});
+
+    ASSERT_FALSE((registry.contains<int, char>(entt::group_t{})));
+
+    registry.sort<int>([](const auto lhs, const auto rhs) { return lhs < rhs; });
+    registry.prepare<int, double>(entt::group_t{});
+
+    ASSERT_TRUE((registry.contains<int, double>(entt::group_t{})));
+    ASSERT_TRUE((registry.view<int, double>(entt::group_t{}).empty()));
+
+    registry.assign<double>(e1, 1.);
+    registry.destroy(e0);
+
+    ASSERT_EQ((registry.view<int, double>(entt::group_t{}).size()), decltype(registry.size())(1));
+    ASSERT_EQ((*registry.view<int, double>(entt::group_t{}).data()), e1);
+}
+
 TEST(DefaultRegistry, PersistentView) {
     entt::DefaultRegistry registry;
     auto view = registry.view<int, char>(entt::persistent_t{});
@@ -704,6 +800,285 @@ TEST(DefaultRegistry, ComponentSignals) {
     ASSERT_EQ(listener.last, e1);
 }
 
+TEST(DefaultRegistry, AssignRemoveRange) {
+    entt::DefaultRegistry registry;
+    entt::DefaultRegistry::entity_type entities[3];
+    Listener listener;
+
+    registry.construction<int>().connect<Listener, &Listener::incrComponent<int>>(&listener);
+    registry.destruction<int>().connect<Listener, &Listener::decrComponent<int>>(&listener);
+
+    for(auto &&entity: entities) {
+        entity = registry.create();
+    }
+
+    auto *instances = registry.assign<int>(std::begin(entities), std::end(entities), 42);
+
+    ASSERT_EQ(listener.counter, 3);
+    ASSERT_EQ(listener.last, entities[2]);
+    ASSERT_EQ(registry.size<int>(), 3u);
+    ASSERT_EQ(instances, registry.raw<int>());
+    ASSERT_EQ(registry.get<int>(entities[0]), 42);
+    ASSERT_EQ(registry.get<int>(entities[2]), 42);
+
+    registry.remove<int>(std::begin(entities), std::begin(entities) + 2);
+
+    ASSERT_EQ(listener.counter, 1);
+    ASSERT_EQ(listener.last, entities[1]);
+    ASSERT_FALSE((registry.has<int>(entities[0])));
+    ASSERT_FALSE((registry.has<int>(entities[1])));
+    ASSERT_TRUE((registry.has<int>(entities[2])));
+
+    registry.assign<char>(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(registry.size<char>(), 3u);
+    ASSERT_EQ(registry.get<char>(entities[1]), char{});
+}
+
+TEST(DefaultRegistry, AssignRangeFromArray) {
+    entt::DefaultRegistry registry;
+    entt::DefaultRegistry::entity_type entities[3];
+    const int values[] = { 1, 2, 3 };
+    int sum = 0;
+
+    for(auto &&entity: entities) {
+        entity = registry.create();
+    }
+
+    struct Summer {
+        void add(entt::DefaultRegistry &registry, entt::DefaultRegistry::entity_type entity) {
+            // components are already in place when listeners are notified
+            *sum += registry.get<int>(entity);
+        }
+
+        int *sum;
+    } listener{&sum};
+
+    registry.construction<int>().connect<Summer, &Summer::add>(&listener);
+    auto *instances = registry.assign<int>(std::begin(entities), std::end(entities), values);
+
+    ASSERT_EQ(sum, 6);
+    ASSERT_EQ(registry.size<int>(), 3u);
+    ASSERT_EQ(instances, registry.raw<int>());
+    ASSERT_EQ(registry.get<int>(entities[0]), 1);
+    ASSERT_EQ(registry.get<int>(entities[1]), 2);
+    ASSERT_EQ(registry.get<int>(entities[2]), 3);
+}
+
+TEST(DefaultRegistry, AssignRangeToOwnedPool) {
+    entt::DefaultRegistry registry;
+    entt::DefaultRegistry::entity_type entities[2];
+    const char values[] = { 'x', 'y' };
+
+    registry.prepare<int, char>(entt::group_t{});
+
+    const auto other = registry.create();
+    registry.assign<char>(other, 'z');
+
+    for(auto &&entity: entities) {
+        entity = registry.create();
+        registry.assign<int>(entity, 0);
+    }
+
+    ASSERT_EQ(registry.assign<char>(std::begin(entities), std::end(entities), values), nullptr);
+    ASSERT_EQ(registry.get<char>(entities[0]), 'x');
+    ASSERT_EQ(registry.get<char>(entities[1]), 'y');
+    ASSERT_EQ(registry.get<char>(other), 'z');
+    ASSERT_EQ((registry.view<int, char>(entt::group_t{}).size()), 2u);
+
+    const auto entity = registry.create();
+    registry.assign<int>(entity, 0);
+
+    ASSERT_EQ(registry.assign<char>(&entity, &entity + 1, 'w'), nullptr);
+    ASSERT_EQ(registry.get<char>(entity), 'w');
+    ASSERT_EQ((registry.view<int, char>(entt::group_t{}).size()), 3u);
+
+    registry.view<int, char>(entt::group_t{}).each([](const auto, const auto &, const auto &value) {
+        ASSERT_NE(value, 'z');
+    });
+}
+
+template<std::size_t>
+struct Sig {};
+
+template<std::size_t... Indexes>
+void assignSig(entt::DefaultRegistry &registry, entt::DefaultRegistry::entity_type entity, std::index_sequence<Indexes...>) {
+    using accumulator_type = int[];
+    accumulator_type accumulator = { 0, (registry.assign<Sig<Indexes>>(entity), 0)... };
+    (void)accumulator;
+}
+
+TEST(DefaultRegistry, Signatures) {
+    entt::DefaultRegistry registry;
+
+    const auto e0 = registry.create();
+    registry.assign<int>(e0);
+    registry.assign<char>(e0);
+
+    const auto e1 = registry.create();
+    registry.assign<int>(e1);
+
+    ASSERT_FALSE(registry.signatures());
+
+    registry.signatures(true);
+
+    ASSERT_TRUE(registry.signatures());
+    ASSERT_TRUE((registry.has<int, char>(e0)));
+    ASSERT_FALSE((registry.has<int, char>(e1)));
+    ASSERT_FALSE((registry.has<int, double>(e0)));
+
+    registry.remove<int>(e1);
+
+    ASSERT_FALSE(registry.has<int>(e1));
+    ASSERT_TRUE(registry.orphan(e1));
+    ASSERT_FALSE(registry.orphan(e0));
+
+    registry.accommodate<double>(e1);
+    registry.accommodate<double>(e1);
+
+    ASSERT_TRUE((registry.has<double>(e1)));
+    ASSERT_FALSE(registry.orphan(e1));
+
+    registry.reset<double>(e1);
+
+    ASSERT_TRUE(registry.orphan(e1));
+
+    const auto e2 = registry.create();
+    assignSig(registry, e2, std::make_index_sequence<130>{});
+    registry.assign<char>(e2);
+
+    ASSERT_TRUE((registry.has<char, Sig<0>, Sig<64>, Sig<129>>(e2)));
+    ASSERT_TRUE((registry.has<int, char>(e0)));
+
+    registry.destroy(e2);
+
+    ASSERT_EQ(registry.size<char>(), 1u);
+    ASSERT_EQ(registry.size<Sig<0>>(), 0u);
+    ASSERT_EQ(registry.size<Sig<129>>(), 0u);
+
+    registry.reset<char>();
+
+    ASSERT_FALSE((registry.has<int, char>(e0)));
+    ASSERT_TRUE((registry.has<int>(e0)));
+
+    registry.signatures(false);
+
+    ASSERT_FALSE(registry.signatures());
+    ASSERT_TRUE((registry.has<int>(e0)));
+    ASSERT_FALSE((registry.has<int, char>(e0)));
+
+    registry.destroy(e0);
+
+    ASSERT_TRUE(registry.empty<int>());
+}
+
+TEST(DefaultRegistry, SignaturesWithoutComponents) {
+    entt::DefaultRegistry registry;
+    registry.signatures(true);
+
+    const auto entity = registry.create();
+
+    ASSERT_TRUE(registry.orphan(entity));
+    ASSERT_FALSE(registry.has<int>(entity));
+
+    registry.destroy(entity);
+
+    ASSERT_FALSE(registry.valid(entity));
+
+    const auto other = registry.create();
+    registry.assign<int>(other);
+    registry.remove<int>(other);
+    registry.destroy(other);
+
+    ASSERT_TRUE(registry.empty());
+}
+
+TEST(DefaultRegistry, SignaturesAfterRestore) {
+    entt::DefaultRegistry registry;
+    registry.signatures(true);
+    registry.assign<int>(registry.create());
+
+    registry.restore();
+
+    ASSERT_TRUE(registry.signatures());
+    ASSERT_TRUE(registry.empty());
+
+    const auto entity = registry.create();
+    registry.assign<int>(entity);
+
+    ASSERT_FALSE(registry.orphan(entity));
+    ASSERT_TRUE(registry.has<int>(entity));
+}
+
+TEST(DefaultRegistry, AccommodateSignals) {
+    entt::DefaultRegistry registry;
+    Listener listener;
+
+    registry.prepare<int, char>();
+    registry.construction<int>().connect<Listener, &Listener::incrComponent<int>>(&listener);
+
+    const auto entity = registry.create();
+    registry.assign<char>(entity);
+    registry.accommodate<int>(entity, 1);
+    registry.accommodate<int>(entity, 2);
+
+    ASSERT_EQ(listener.counter, 1);
+    ASSERT_EQ(listener.last, entity);
+    ASSERT_EQ((registry.view<int, char>(entt::persistent_t{}).size()), 1u);
+}
+
+TEST(DefaultRegistry, UpdateSignals) {
+    entt::DefaultRegistry registry;
+    Listener listener;
+
+    registry.update<int>().connect<Listener, &Listener::incrComponent<int>>(&listener);
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+
+    registry.assign<int>(e0, 0);
+    registry.accommodate<int>(e1, 1);
+
+    ASSERT_EQ(listener.counter, 0);
+
+    registry.replace<int>(e0, 3);
+
+    ASSERT_EQ(listener.counter, 1);
+    ASSERT_EQ(listener.last, e0);
+    ASSERT_EQ(registry.get<int>(e0), 3);
+
+    registry.accommodate<int>(e1, 4);
+
+    ASSERT_EQ(listener.counter, 2);
+    ASSERT_EQ(listener.last, e1);
+    ASSERT_EQ(registry.get<int>(e1), 4);
+
+    registry.update<int>().disconnect<Listener, &Listener::incrComponent<int>>(&listener);
+    registry.replace<int>(e0, 5);
+
+    ASSERT_EQ(listener.counter, 2);
+}
+
+TEST(DefaultRegistry, Patch) {
+    struct Large { int value; char padding[196]; };
+
+    entt::DefaultRegistry registry;
+    Listener listener;
+
+    registry.update<Large>().connect<Listener, &Listener::incrComponent<Large>>(&listener);
+
+    const auto entity = registry.create();
+    registry.assign<Large>(entity, 0).padding[0] = 'c';
+
+    auto &large = registry.patch<Large>(entity, [](auto &instance) { instance.value = 42; });
+
+    ASSERT_EQ(&large, &registry.get<Large>(entity));
+    ASSERT_EQ(large.value, 42);
+    ASSERT_EQ(large.padding[0], 'c');
+    ASSERT_EQ(listener.counter, 1);
+    ASSERT_EQ(listener.last, entity);
+}
+
 TEST(DefaultRegistry, TagSignals) {
     entt::DefaultRegistry registry;
     Listener listener;
@@ -741,3 +1116,219 @@ TEST(DefaultRegistry, TagSignals) {
     ASSERT_EQ(listener.counter, 0);
     ASSERT_EQ(listener.last, e0);
 }
+
+TEST(DefaultRegistry, MemoryResource) {
+    struct CountingResource final: entt::MemoryResource {
+        std::size_t allocated{};
+        std::size_t deallocated{};
+
+    private:
+        void * do_allocate(std::size_t bytes, std::size_t alignment) override {
+            return ++allocated, entt::default_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) override {
+            ++deallocated;
+            entt::default_resource()->deallocate(ptr, bytes, alignment);
+        }
+    };
+
+    CountingResource upstream;
+    entt::MonotonicResource arena{&upstream};
+
+    ASSERT_EQ(entt::DefaultRegistry{}.resource(), entt::default_resource());
+
+    {
+        entt::DefaultRegistry registry{&arena};
+
+        ASSERT_EQ(registry.resource(), &arena);
+
+        registry.signatures(true);
+        registry.prepare<int, char>();
+        registry.prepare<int, double>(entt::group_t{});
+
+        for(auto i = 0; i < 100; ++i) {
+            const auto entity = registry.create();
+            registry.assign<int>(entity, i);
+            registry.assign<char>(entity, 'c');
+            registry.assign<double>(entity, .0);
+        }
+
+        registry.assign<float>(entt::tag_t{}, registry.create(), 3.f);
+        registry.destroy(registry.attachee<float>());
+
+        ASSERT_EQ((registry.view<int, char>(entt::persistent_t{}).size()), 100u);
+        ASSERT_EQ((registry.view<int, double>(entt::group_t{}).size()), 100u);
+        ASSERT_EQ(upstream.deallocated, 0u);
+
+        entt::DefaultRegistry other{std::move(registry)};
+
+        ASSERT_EQ(other.resource(), &arena);
+        ASSERT_EQ(other.get<int>(entt::DefaultRegistry::entity_type{}), 0);
+    }
+
+    ASSERT_GT(upstream.allocated, 0u);
+    ASSERT_EQ(upstream.deallocated, 0u);
+
+    arena.release();
+
+    ASSERT_EQ(upstream.allocated, upstream.deallocated);
+}
+
+TEST(DefaultRegistry, StructureOfArrays) {
+    entt::DefaultRegistry registry;
+    const auto &cregistry = registry;
+
+    ASSERT_FALSE(registry.raw<Velocity>());
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+
+    registry.assign<Velocity>(e0, 1.f, 2.f);
+    registry.assign<Velocity>(e1).get<0>() = 3.f;
+    registry.assign<int>(e1, 42);
+
+    ASSERT_EQ(cregistry.get<Velocity>(e0).get<1>(), 2.f);
+    ASSERT_EQ(std::get<0>(cregistry.get<Velocity, int>(e1)).get<0>(), 3.f);
+    ASSERT_EQ(std::get<1>(registry.get<Velocity, int>(e1)), 42);
+
+    registry.replace<Velocity>(e0, 4.f, 5.f);
+    registry.accommodate<Velocity>(e1, 6.f, 7.f);
+
+    ASSERT_EQ(static_cast<Velocity>(registry.get<Velocity>(e0)).dx, 4.f);
+    ASSERT_EQ(registry.raw<Velocity>().get<1>()[1], 7.f);
+
+    registry.patch<Velocity>(e1, [](auto &&velocity) { velocity.template get<1>() = 8.f; });
+
+    ASSERT_EQ(static_cast<Velocity>(registry.get<Velocity>(e1)).dx, 6.f);
+    ASSERT_EQ(static_cast<Velocity>(registry.get<Velocity>(e1)).dy, 8.f);
+
+    registry.sort<Velocity>([](const auto &lhs, const auto &rhs) { return lhs.dx > rhs.dx; });
+
+    ASSERT_EQ(*registry.data<Velocity>(), e0);
+
+    registry.remove<Velocity>(e0);
+
+    ASSERT_EQ(registry.size<Velocity>(), 1u);
+    ASSERT_EQ(*cregistry.raw<Velocity>().get<0>(), 6.f);
+
+    const entt::DefaultRegistry::entity_type entities[] = { registry.create(), registry.create() };
+    auto first = registry.assign<Velocity>(std::begin(entities), std::end(entities), Velocity{8.f, 9.f});
+
+    ASSERT_EQ(first.get<0>()[1], 8.f);
+    ASSERT_EQ(registry.get<Velocity>(entities[1]).get<1>(), 9.f);
+}
+
+TEST(DefaultRegistry, StructureOfArraysWithBooleans) {
+    entt::DefaultRegistry registry;
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+
+    registry.assign<Status>(e0, 1, true);
+    registry.assign<Status>(e1, 2, false);
+
+    ASSERT_TRUE(registry.get<Status>(e0).get<1>());
+    ASSERT_FALSE(registry.get<Status>(e1).get<1>());
+
+    registry.get<Status>(e1).get<1>() = true;
+    registry.replace<Status>(e0, 3, false);
+
+    ASSERT_TRUE(static_cast<Status>(registry.get<Status>(e1)).alive);
+    ASSERT_FALSE(static_cast<Status>(registry.get<Status>(e0)).alive);
+
+    registry.sort<Status>([](const auto &lhs, const auto &rhs) { return lhs.health > rhs.health; });
+
+    const auto raw = registry.raw<Status>();
+
+    ASSERT_EQ(raw.get<0>()[0], 2);
+    ASSERT_TRUE(raw.get<1>()[0]);
+    ASSERT_FALSE(raw.get<1>()[1]);
+
+    raw.get<1>()[1] = true;
+
+    ASSERT_TRUE(registry.get<Status>(e0).get<1>());
+}
+
+TEST(DefaultRegistry, Freeze) {
+    entt::DefaultRegistry registry;
+
+    ASSERT_FALSE(registry.frozen());
+
+    const auto entity = registry.create();
+    registry.assign<int>(entity, 0);
+    registry.prepare<int, char>();
+    registry.freeze<int, char, double>();
+
+    ASSERT_TRUE(registry.frozen());
+    ASSERT_TRUE(registry.empty<double>());
+    ASSERT_EQ(registry.view<char>().size(), 0u);
+    ASSERT_EQ((registry.view<int, char>(entt::persistent_t{}).size()), 0u);
+
+    registry.replace<int>(entity, 1);
+    registry.patch<int>(entity, [](auto &value) { ++value; });
+
+    ASSERT_EQ(registry.get<int>(entity), 2);
+
+    registry.thaw();
+
+    ASSERT_FALSE(registry.frozen());
+
+    registry.assign<char>(entity);
+
+    ASSERT_EQ((registry.view<int, char>(entt::persistent_t{}).size()), 1u);
+}
+
+TEST(DefaultRegistry, FrozenConcurrentAccess) {
+    entt::DefaultRegistry registry;
+    std::vector<std::thread> workers;
+    constexpr auto count = 4;
+
+    for(auto i = 0; i < 10000; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, i);
+        registry.assign<char>(entity, 'c');
+
+        if(i % 2) {
+            registry.assign<double>(entity, 0.);
+        }
+    }
+
+    registry.prepare<int, char>();
+    registry.prepare<int, double>(entt::group_t{});
+    registry.freeze<int, char, double, float>();
+
+    for(auto pos = 0; pos < count; ++pos) {
+        workers.emplace_back([&registry, pos]() {
+            const auto &cregistry = registry;
+            std::size_t visited{};
+
+            // every thread reads all the pools and updates only its share of doubles
+            registry.view<int, char>().each([&visited](auto, const int &, const char &) { ++visited; });
+            registry.view<int, char>(entt::persistent_t{}).each([&visited](auto, const int &, const char &) { ++visited; });
+            registry.view<float>().each([&visited](auto, const float &) { ++visited; });
+
+            registry.view<int, double>(entt::group_t{}).each([&cregistry, pos](auto entity, const int &value, double &other) {
+                if(value % count == pos) {
+                    other += cregistry.get<int>(entity);
+                }
+            });
+
+            registry.view<int>(entt::raw_t{}).each([&visited](const int &) { ++visited; });
+
+            for(auto *entity = cregistry.data<int>(), *last = entity + cregistry.size<int>(); entity != last; ++entity) {
+                visited += cregistry.has<int, char>(*entity) && cregistry.valid(*entity);
+            }
+
+            ASSERT_EQ(visited, 40000u);
+        });
+    }
+
+    for(auto &&worker: workers) {
+        worker.join();
+    }
+
+    registry.view<int, double>().each([](auto, const int &value, const double &other) {
+        ASSERT_EQ(other, value);
+    });
+}
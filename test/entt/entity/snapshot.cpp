@@ -1,6 +1,8 @@
 #include <tuple>
 #include <queue>
 #include <vector>
+#include <sstream>
+#include <iterator>
 #include <gtest/gtest.h>
 #include <entt/entity/registry.hpp>
 
@@ -283,6 +285,44 @@ TEST(Snapshot, Iterator) {
     });
 }
 
+TEST(Snapshot, SinglePassIterator) {
+    entt::DefaultRegistry registry;
+    std::stringstream entities;
+
+    for(auto i = 0; i < 50; ++i) {
+        const auto entity = registry.create();
+        registry.assign<AnotherComponent>(entity, i, i);
+
+        if(i % 2) {
+            registry.assign<AComponent>(entity);
+            entities << entity << ' ';
+        }
+    }
+
+    using storage_type = std::tuple<
+        std::queue<entt::DefaultRegistry::entity_type>,
+        std::queue<AComponent>,
+        std::queue<AnotherComponent>
+    >;
+
+    storage_type storage;
+    OutputArchive<storage_type> output{storage};
+    InputArchive<storage_type> input{storage};
+
+    std::istream_iterator<entt::DefaultRegistry::entity_type> first{entities};
+    registry.snapshot().component<AnotherComponent, AComponent>(output, first, {});
+    registry.reset();
+    registry.restore().component<AnotherComponent, AComponent>(input);
+
+    ASSERT_EQ(registry.view<AnotherComponent>().size(), 25u);
+    ASSERT_EQ(registry.view<AComponent>().size(), 25u);
+
+    registry.view<AnotherComponent>().each([](const auto entity, const auto &component) {
+        ASSERT_TRUE(entity % 2);
+        ASSERT_EQ(component.key, static_cast<int>(entity));
+    });
+}
+
 TEST(Snapshot, Continuous) {
     using entity_type = entt::DefaultRegistry::entity_type;
 
@@ -523,6 +563,50 @@ TEST(Snapshot, ContinuousMoreOnShrink) {
     ASSERT_FALSE(dst.valid(entity));
 }
 
+TEST(Snapshot, ContinuousRecycledIdentifiers) {
+    using entity_type = entt::DefaultRegistry::entity_type;
+
+    entt::DefaultRegistry src;
+    entt::DefaultRegistry dst;
+
+    entt::ContinuousLoader<entity_type> loader{dst};
+
+    using storage_type = std::tuple<
+        std::queue<entity_type>,
+        std::queue<AComponent>
+    >;
+
+    storage_type storage;
+    OutputArchive<storage_type> output{storage};
+    InputArchive<storage_type> input{storage};
+
+    const auto entity = src.create();
+    src.snapshot().entities(output).destroyed(output);
+    loader.entities(input).destroyed(input).shrink();
+
+    const auto local = loader.map(entity);
+    src.destroy(entity);
+    const auto other = src.create();
+
+    ASSERT_NE(entity, other);
+
+    src.snapshot().entities(output).destroyed(output);
+    loader.entities(input).destroyed(input);
+
+    ASSERT_TRUE(loader.has(entity));
+    ASSERT_TRUE(loader.has(other));
+    ASSERT_EQ(loader.map(entity), local);
+    ASSERT_NE(loader.map(other), local);
+    ASSERT_TRUE(dst.valid(local));
+
+    loader.shrink();
+
+    ASSERT_FALSE(loader.has(entity));
+    ASSERT_TRUE(loader.has(other));
+    ASSERT_FALSE(dst.valid(local));
+    ASSERT_TRUE(dst.valid(loader.map(other)));
+}
+
 TEST(Snapshot, SyncDataMembers) {
     using entity_type = entt::DefaultRegistry::entity_type;
 
@@ -1,7 +1,37 @@
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <tuple>
 #include <unordered_set>
 #include <gtest/gtest.h>
 #include <entt/entity/sparse_set.hpp>
 
+struct Transform {
+    float x;
+    float y;
+    float angle;
+};
+
+struct Vector {
+    float x;
+    float y;
+    float z;
+};
+
+namespace entt {
+
+template<>
+struct storage_alignment<Vector>: std::integral_constant<std::size_t, 32> {};
+
+template<>
+struct soa_traits<Transform> {
+    static auto members() ENTT_NOEXCEPT {
+        return std::make_tuple(&Transform::x, &Transform::y);
+    }
+};
+
+}
+
 TEST(SparseSetNoType, Functionalities) {
     entt::SparseSet<unsigned int> set;
     const auto &cset = set;
@@ -54,6 +84,78 @@ TEST(SparseSetNoType, Functionalities) {
     other = std::move(set);
 }
 
+TEST(SparseSetNoType, Pagination) {
+    entt::SparseSet<unsigned int> set;
+    constexpr auto entt_per_page = ENTT_PAGE_SIZE / sizeof(unsigned int);
+
+    ASSERT_EQ(set.extent(), 0u);
+
+    set.construct(entt_per_page-1);
+
+    ASSERT_EQ(set.extent(), entt_per_page);
+    ASSERT_TRUE(set.has(entt_per_page-1));
+    ASSERT_FALSE(set.has(entt_per_page));
+
+    set.construct(3*entt_per_page);
+
+    ASSERT_EQ(set.extent(), 4*entt_per_page);
+    ASSERT_TRUE(set.has(entt_per_page-1));
+    ASSERT_FALSE(set.has(entt_per_page));
+    ASSERT_FALSE(set.fast(2*entt_per_page));
+    ASSERT_TRUE(set.fast(3*entt_per_page));
+    ASSERT_EQ(set.get(entt_per_page-1), 0u);
+    ASSERT_EQ(set.get(3*entt_per_page), 1u);
+
+    set.destroy(entt_per_page-1);
+
+    ASSERT_EQ(set.extent(), 4*entt_per_page);
+    ASSERT_FALSE(set.has(entt_per_page-1));
+    ASSERT_TRUE(set.has(3*entt_per_page));
+    ASSERT_EQ(set.get(3*entt_per_page), 0u);
+
+    set.reset();
+
+    ASSERT_EQ(set.extent(), 0u);
+    ASSERT_FALSE(set.has(3*entt_per_page));
+}
+
+TEST(SparseSetNoType, Prefetch) {
+    entt::SparseSet<unsigned int> set;
+    constexpr auto entt_per_page = ENTT_PAGE_SIZE / sizeof(unsigned int);
+
+    set.prefetch(0u);
+    set.construct(3*entt_per_page);
+    set.prefetch(0u);
+    set.prefetch(3*entt_per_page);
+    set.prefetch(8*entt_per_page);
+
+    ASSERT_EQ(set.size(), 1u);
+    ASSERT_FALSE(set.has(0u));
+    ASSERT_TRUE(set.has(3*entt_per_page));
+}
+
+TEST(SparseSetNoType, BatchConstruct) {
+    entt::SparseSet<unsigned int> set;
+    unsigned int entities[] = { 3, 12, 42 };
+
+    set.construct(4);
+    set.construct(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(set.size(), 4u);
+    ASSERT_TRUE(set.has(3));
+    ASSERT_TRUE(set.has(4));
+    ASSERT_EQ(set.get(4), 0u);
+    ASSERT_EQ(set.get(3), 1u);
+    ASSERT_EQ(set.get(12), 2u);
+    ASSERT_EQ(set.get(42), 3u);
+    ASSERT_EQ(*set.begin(), 42u);
+
+    set.destroy(12);
+
+    ASSERT_FALSE(set.has(12));
+    ASSERT_EQ(set.get(42), 2u);
+}
+
 TEST(SparseSetNoType, DataBeginEnd) {
     entt::SparseSet<unsigned int> set;
 
@@ -307,6 +409,56 @@ TEST(SparseSetWithType, Functionalities) {
     other = std::move(set);
 }
 
+TEST(SparseSetWithType, Prefetch) {
+    entt::SparseSet<unsigned int, int> set;
+    entt::SparseSet<unsigned int, std::tuple<>> empty;
+
+    set.construct(42u, 3);
+    empty.construct(42u);
+
+    set.prefetch_object(0u);
+    set.prefetch_object(42u);
+    empty.prefetch_object(0u);
+    empty.prefetch_object(42u);
+
+    ASSERT_EQ(set.size(), 1u);
+    ASSERT_EQ(set.get(42u), 3);
+    ASSERT_EQ(empty.size(), 1u);
+}
+
+TEST(SparseSetWithType, BatchConstruct) {
+    entt::SparseSet<unsigned int, int> set;
+    unsigned int entities[] = { 3, 12, 42 };
+
+    set.construct(0, 1);
+    auto *instances = set.construct(std::begin(entities), std::end(entities), 7);
+
+    ASSERT_EQ(set.size(), 4u);
+    ASSERT_EQ(instances, set.raw() + 1);
+    ASSERT_EQ(set.get(0), 1);
+    ASSERT_EQ(set.get(3), 7);
+    ASSERT_EQ(set.get(12), 7);
+    ASSERT_EQ(set.get(42), 7);
+
+    instances[2] = 99;
+
+    ASSERT_EQ(set.get(42), 99);
+
+    set.construct(std::begin(entities), std::begin(entities));
+
+    ASSERT_EQ(set.size(), 4u);
+
+    unsigned int others[] = { 5, 7 };
+    const int values[] = { 55, 77 };
+    instances = set.construct(std::begin(others), std::end(others), values);
+
+    ASSERT_EQ(set.size(), 6u);
+    ASSERT_EQ(instances, set.raw() + 4);
+    ASSERT_EQ(set.get(5), 55);
+    ASSERT_EQ(set.get(7), 77);
+    ASSERT_EQ(set.get(42), 99);
+}
+
 TEST(SparseSetWithType, AggregatesMustWork) {
     struct AggregateType { int value; };
     // the goal of this test is to enforce the requirements for aggregate types
@@ -461,6 +613,127 @@ TEST(SparseSetWithType, SortUnordered) {
     ASSERT_EQ(begin, end);
 }
 
+TEST(SparseSetWithType, SortNotTriviallyCopyable) {
+    entt::SparseSet<unsigned int, std::unique_ptr<int>> set;
+
+    set.construct(12, std::make_unique<int>(6));
+    set.construct(42, std::make_unique<int>(3));
+    set.construct(7, std::make_unique<int>(1));
+    set.construct(3, std::make_unique<int>(9));
+    set.construct(9, std::make_unique<int>(12));
+
+    set.sort([](const auto &lhs, const auto &rhs) {
+        return *lhs < *rhs;
+    });
+
+    auto begin = set.begin();
+    auto end = set.end();
+
+    ASSERT_EQ(**(begin++), 1);
+    ASSERT_EQ(**(begin++), 3);
+    ASSERT_EQ(**(begin++), 6);
+    ASSERT_EQ(**(begin++), 9);
+    ASSERT_EQ(**(begin++), 12);
+    ASSERT_EQ(begin, end);
+
+    set.sort([](const auto &lhs, const auto &rhs) {
+        return *lhs > *rhs;
+    }, entt::InsertionSort{});
+
+    ASSERT_EQ(*set.get(12), 6);
+    ASSERT_EQ(*set.get(42), 3);
+    ASSERT_EQ(*set.get(7), 1);
+    ASSERT_EQ(*set.get(3), 9);
+    ASSERT_EQ(*set.get(9), 12);
+    ASSERT_EQ(**set.begin(), 12);
+}
+
+TEST(SparseSetWithType, SortAgain) {
+    entt::SparseSet<unsigned int, int> set;
+
+    for(auto i = 0u; i < 100u; ++i) {
+        set.construct(i, int(i * 37 % 101));
+    }
+
+    set.sort([](const auto lhs, const auto rhs) { return lhs < rhs; });
+    set.destroy(42);
+    set.construct(200, -1);
+    set.sort([](const auto lhs, const auto rhs) { return lhs < rhs; }, entt::InsertionSort{});
+
+    ASSERT_EQ(*set.begin(), -1);
+
+    for(auto it = set.begin(), next = ++set.begin(); next != set.end(); ++it, ++next) {
+        ASSERT_LT(*it, *next);
+    }
+
+    for(auto entity: static_cast<const entt::SparseSet<unsigned int> &>(set)) {
+        ASSERT_EQ(set.get(entity), entity == 200 ? -1 : int(entity * 37 % 101));
+    }
+}
+
+TEST(SparseSetWithType, SortKey) {
+    entt::SparseSet<unsigned int, unsigned int> set;
+
+    set.construct(12, 6u);
+    set.construct(42, 3u);
+    set.construct(7, 1u);
+    set.construct(3, 9u);
+    set.construct(9, 12u);
+
+    set.sort([](const auto value) {
+        return value;
+    }, entt::RadixSort<8, 32>{});
+
+    ASSERT_EQ(*(set.raw() + 0u), 12u);
+    ASSERT_EQ(*(set.raw() + 1u), 9u);
+    ASSERT_EQ(*(set.raw() + 2u), 6u);
+    ASSERT_EQ(*(set.raw() + 3u), 3u);
+    ASSERT_EQ(*(set.raw() + 4u), 1u);
+
+    auto begin = set.begin();
+    auto end = set.end();
+
+    ASSERT_EQ(*(begin++), 1u);
+    ASSERT_EQ(*(begin++), 3u);
+    ASSERT_EQ(*(begin++), 6u);
+    ASSERT_EQ(*(begin++), 9u);
+    ASSERT_EQ(*(begin++), 12u);
+    ASSERT_EQ(begin, end);
+
+    ASSERT_EQ(set.get(12), 6u);
+    ASSERT_EQ(set.get(42), 3u);
+    ASSERT_EQ(set.get(7), 1u);
+    ASSERT_EQ(set.get(3), 9u);
+    ASSERT_EQ(set.get(9), 12u);
+}
+
+TEST(SparseSetWithType, SortWideKey) {
+    entt::SparseSet<unsigned int, std::uint64_t> set;
+
+    set.construct(12, std::uint64_t{6} << 40);
+    set.construct(42, 3u);
+    set.construct(7, std::uint64_t{1} << 40);
+    set.construct(3, 9u);
+
+    set.sort([](const auto value) {
+        return value;
+    }, entt::RadixSort<8, 64>{});
+
+    ASSERT_EQ(*(set.raw() + 0u), std::uint64_t{6} << 40);
+    ASSERT_EQ(*(set.raw() + 1u), std::uint64_t{1} << 40);
+    ASSERT_EQ(*(set.raw() + 2u), 9u);
+    ASSERT_EQ(*(set.raw() + 3u), 3u);
+
+    set.sort([](const auto value) {
+        return value % 10u;
+    }, entt::RadixSort<8, 64>{});
+
+    ASSERT_EQ(*(set.raw() + 0u), 9u);
+    ASSERT_EQ(*(set.raw() + 3u), 3u);
+    ASSERT_EQ(set.get(12), std::uint64_t{6} << 40);
+    ASSERT_EQ(set.get(7), std::uint64_t{1} << 40);
+}
+
 TEST(SparseSetWithType, RespectDisjoint) {
     entt::SparseSet<unsigned int, int> lhs;
     entt::SparseSet<unsigned int, int> rhs;
@@ -687,6 +960,55 @@ TEST(SparseSetWithType, ReferencesGuaranteed) {
     ASSERT_EQ(set.get(1).value, 3);
 }
 
+TEST(SparseSetWithType, EmptyType) {
+    struct Empty {};
+    entt::SparseSet<unsigned int, Empty> set;
+    const auto &cset = set;
+
+    set.construct(3);
+    set.construct(12, Empty{});
+    set.construct(42);
+
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_EQ(&set.get(3), &set.get(42));
+    ASSERT_EQ(&cset.get(12), set.raw());
+    ASSERT_EQ(&*set.begin(), set.raw());
+    ASSERT_EQ((set.begin() + 1u).operator->(), set.raw());
+    ASSERT_EQ(set.begin() + 3u, set.end());
+    ASSERT_EQ(cset.cbegin() + 3u, cset.cend());
+
+    set.destroy(12);
+    set.sort([](const auto &, const auto &) { return false; });
+
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_FALSE(set.has(12));
+    ASSERT_EQ(*(set.data() + 0u), 3u);
+    ASSERT_EQ(*(set.data() + 1u), 42u);
+
+    entt::SparseSet<unsigned int> other;
+    other.construct(42);
+    other.construct(3);
+    set.respect(other);
+
+    ASSERT_EQ(*(set.data() + 0u), 42u);
+    ASSERT_EQ(*(set.data() + 1u), 3u);
+
+    std::vector<unsigned int> entities{7, 9};
+
+    ASSERT_EQ(set.construct(entities.begin(), entities.end()), set.raw());
+    ASSERT_EQ(set.size(), 4u);
+
+    set.swap(0u, 3u);
+
+    ASSERT_EQ(&set.get(9), &set.get(42));
+    ASSERT_EQ(*(set.data() + 0u), 9u);
+    ASSERT_EQ(*(set.data() + 3u), 42u);
+
+    set.reset();
+
+    ASSERT_TRUE(set.empty());
+}
+
 TEST(SparseSetWithType, MoveOnlyComponent) {
     struct MoveOnlyComponent {
         MoveOnlyComponent() = default;
@@ -701,3 +1023,167 @@ TEST(SparseSetWithType, MoveOnlyComponent) {
     entt::SparseSet<unsigned int, MoveOnlyComponent> set;
     (void)set;
 }
+
+TEST(SparseSetWithType, MemoryResource) {
+    struct CountingResource final: entt::MemoryResource {
+        std::size_t allocated{};
+        std::size_t deallocated{};
+
+    private:
+        void * do_allocate(std::size_t bytes, std::size_t alignment) override {
+            return ++allocated, entt::default_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) override {
+            ++deallocated;
+            entt::default_resource()->deallocate(ptr, bytes, alignment);
+        }
+    };
+
+    CountingResource resource;
+
+    {
+        entt::SparseSet<unsigned int, int> set{&resource};
+
+        ASSERT_EQ(set.resource(), &resource);
+        ASSERT_EQ(entt::SparseSet<unsigned int>{}.resource(), entt::default_resource());
+
+        set.reserve(2);
+        set.construct(3, 3);
+        set.construct(42, 42);
+
+        // the sparse array and its only page, the packed array and the array of objects
+        ASSERT_EQ(resource.allocated, 4u);
+
+        set.sort(std::less<int>{});
+        set.sort([](const auto &value) { return unsigned(value); }, entt::RadixSort<8, 32>{});
+
+        ASSERT_EQ(*set.begin(), 3);
+        ASSERT_GT(resource.allocated, 4u);
+
+        entt::SparseSet<unsigned int, int> other{std::move(set)};
+
+        ASSERT_EQ(other.resource(), &resource);
+        ASSERT_EQ(other.get(42), 42);
+    }
+
+    ASSERT_EQ(resource.allocated, resource.deallocated);
+}
+
+TEST(SparseSetWithType, StructureOfArrays) {
+    entt::SparseSet<unsigned int, Transform> set;
+    const auto &cset = set;
+
+    set.reserve(4);
+    set.construct(3, Transform{3.f, 30.f, 1.f});
+    set.construct(12, 12.f, 120.f, 1.f);
+    set.construct(42, Transform{42.f, 420.f, 1.f});
+
+    const float *x = cset.raw().get<0>();
+    float *y = set.raw().get<1>();
+
+    ASSERT_EQ(x[0], 3.f);
+    ASSERT_EQ(x[1], 12.f);
+    ASSERT_EQ(x[2], 42.f);
+    ASSERT_EQ(y[1], 120.f);
+    ASSERT_EQ(set.raw()[2].get<1>(), 420.f);
+
+    // data members that aren't listed by the traits aren't stored
+    ASSERT_EQ(static_cast<Transform>(cset.get(12)).angle, 0.f);
+
+    set.get(12) = Transform{-12.f, -120.f, 0.f};
+    set.get(3).get<0>() = -3.f;
+
+    ASSERT_EQ(x[0], -3.f);
+    ASSERT_EQ(x[1], -12.f);
+    ASSERT_EQ(cset.get(12).get<1>(), -120.f);
+
+    set.destroy(3);
+
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_EQ(x[0], 42.f);
+    ASSERT_EQ(cset.get(42).get<1>(), 420.f);
+
+    set.sort([](const Transform &lhs, const Transform &rhs) { return lhs.y < rhs.y; });
+
+    ASSERT_EQ((*set.begin()).get<1>(), -120.f);
+    ASSERT_EQ((*(set.begin() + 1)).get<1>(), 420.f);
+    ASSERT_EQ(set.begin()->get<1>(), -120.f);
+    ASSERT_EQ(cset.begin()->get<1>(), -120.f);
+
+    (set.begin() + 1)->get<0>() = 43.f;
+
+    ASSERT_EQ(cset.get(42).get<0>(), 43.f);
+
+    (set.begin() + 1)->get<0>() = 42.f;
+
+    entt::SparseSet<unsigned int> other;
+    other.construct(12);
+    other.construct(42);
+
+    set.respect(other);
+
+    ASSERT_EQ(*set.data(), 12u);
+    ASSERT_EQ(x[0], -12.f);
+
+    for(auto &&instance: set) {
+        instance.get<0>() *= 2.f;
+    }
+
+    ASSERT_EQ(cset.get(12).get<0>(), -24.f);
+    ASSERT_EQ(cset.get(42).get<0>(), 84.f);
+
+    unsigned int entities[] = { 1u, 2u };
+    auto first = set.construct(std::begin(entities), std::end(entities), Transform{1.f, 2.f, 3.f});
+
+    ASSERT_EQ(first.get<1>()[1], 2.f);
+    ASSERT_EQ(cset.get(2).get<0>(), 1.f);
+
+    set.reset();
+
+    ASSERT_TRUE(set.empty());
+}
+
+TEST(SparseSetWithType, StorageAlignment) {
+    struct TrackingResource final: entt::MemoryResource {
+        std::size_t bytes{};
+
+    private:
+        void * do_allocate(std::size_t size, std::size_t alignment) override {
+            if(alignment == 32u) {
+                bytes = size;
+            }
+
+            return entt::default_resource()->allocate(size, alignment);
+        }
+
+        void do_deallocate(void *ptr, std::size_t size, std::size_t alignment) override {
+            entt::default_resource()->deallocate(ptr, size, alignment);
+        }
+    };
+
+    TrackingResource resource;
+    entt::SparseSet<unsigned int, Vector> set{&resource};
+
+    for(auto i = 0u; i < 100u; ++i) {
+        set.construct(i, float(i), 0.f, 0.f);
+
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(set.raw()) % 32u, 0u);
+        // the array always extends up to the next multiple of the alignment
+        ASSERT_GE(resource.bytes, (set.size() * sizeof(Vector) + 31u) / 32u * 32u);
+    }
+
+    unsigned int entities[] = { 100u, 101u, 102u };
+    set.construct(std::begin(entities), std::end(entities), Vector{1.f, 2.f, 3.f});
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(set.raw()) % 32u, 0u);
+    ASSERT_GE(resource.bytes, (set.size() * sizeof(Vector) + 31u) / 32u * 32u);
+    ASSERT_EQ(set.get(42).x, 42.f);
+    ASSERT_EQ(set.get(101).y, 2.f);
+
+    set.destroy(42);
+    set.sort([](const auto &lhs, const auto &rhs) { return lhs.x < rhs.x; });
+
+    ASSERT_EQ(set.begin()->x, 0.f);
+    ASSERT_EQ(set.size(), 102u);
+}
@@ -1,7 +1,26 @@
+#include <atomic>
+#include <numeric>
 #include <gtest/gtest.h>
+#include <entt/core/executor.hpp>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/view.hpp>
 
+struct Position {
+    float x;
+    float y;
+};
+
+namespace entt {
+
+template<>
+struct soa_traits<Position> {
+    static auto members() ENTT_NOEXCEPT {
+        return std::make_tuple(&Position::x, &Position::y);
+    }
+};
+
+}
+
 TEST(View, SingleComponent) {
     entt::DefaultRegistry registry;
     auto view = registry.view<char>();
@@ -126,6 +145,75 @@ TEST(View, SingleComponentEach) {
     ASSERT_EQ(cnt, std::size_t{0});
 }
 
+TEST(View, SingleComponentEachChunk) {
+    entt::DefaultRegistry registry;
+
+    for(auto i = 0; i < 2 * ENTT_CHUNK_SIZE + 1; ++i) {
+        registry.assign<int>(registry.create(), i);
+    }
+
+    auto view = registry.view<int>();
+    const auto &cview = static_cast<const decltype(view) &>(view);
+    std::size_t chunks{};
+    std::size_t cnt{};
+
+    view.each_chunk([&chunks, &cnt](const auto *entities, int *values, std::size_t count) {
+        ASSERT_LE(count, std::size_t{ENTT_CHUNK_SIZE});
+
+        for(std::size_t pos = 0; pos < count; ++pos) {
+            ASSERT_EQ(values[pos], int(entities[pos]));
+            values[pos] = -values[pos];
+        }
+
+        ++chunks;
+        cnt += count;
+    });
+
+    ASSERT_EQ(chunks, 3u);
+    ASSERT_EQ(cnt, std::size_t{2 * ENTT_CHUNK_SIZE + 1});
+
+    cview.each_chunk([&cnt, &view](const auto *entities, const int *values, std::size_t count) {
+        ASSERT_EQ(values, &view.get(*entities));
+
+        for(std::size_t pos = 0; pos < count; ++pos) {
+            ASSERT_EQ(values[pos], -int(entities[pos]));
+        }
+
+        cnt -= count;
+    });
+
+    ASSERT_EQ(cnt, 0u);
+
+    registry.reset();
+    view.each_chunk([](auto...) { FAIL(); });
+}
+
+TEST(View, SingleComponentParEach) {
+    entt::DefaultRegistry registry;
+    entt::ThreadPool executor{3};
+
+    for(auto i = 0; i < 3 * ENTT_CHUNK_SIZE + 1; ++i) {
+        registry.assign<int>(registry.create(), i);
+    }
+
+    auto view = registry.view<int>();
+    const auto &cview = static_cast<const decltype(view) &>(view);
+    std::atomic<int> cnt{0};
+
+    view.par_each(executor, [&cnt](auto, int &value) { ++cnt; value = -value; });
+
+    ASSERT_EQ(cnt, 3 * ENTT_CHUNK_SIZE + 1);
+
+    cview.par_each([](std::size_t count, auto job) {
+        for(std::size_t pos = 0; pos < count; ++pos) { job(pos); }
+    }, [&cnt](auto entity, const int &value) {
+        ASSERT_EQ(value, -int(entity));
+        --cnt;
+    });
+
+    ASSERT_EQ(cnt, 0);
+}
+
 TEST(View, MultipleComponent) {
     entt::DefaultRegistry registry;
     auto view = registry.view<int, char>();
@@ -284,6 +372,132 @@ TEST(View, MultipleComponentEachWithHoles) {
     });
 }
 
+TEST(View, MultipleComponentEachUnordered) {
+    entt::DefaultRegistry registry;
+    constexpr auto count = 4 * ENTT_PREFETCH_DISTANCE + 3;
+
+    for(auto i = 0; i < count; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, i);
+
+        if(i % 3) {
+            registry.assign<char>(entity, static_cast<char>(i));
+        }
+    }
+
+    // visiting the pivot out of order forces the view to use the sparse arrays
+    registry.sort<int>([](const auto lhs, const auto rhs) { return lhs > rhs; });
+
+    auto view = registry.view<int, char>();
+    auto visited = 0;
+
+    view.each([&visited](auto, const int &i, const char &c) {
+        ASSERT_NE(i % 3, 0);
+        ASSERT_EQ(c, static_cast<char>(i));
+        ++visited;
+    });
+
+    ASSERT_EQ(visited, count - (count + 2) / 3);
+}
+
+TEST(View, MultipleComponentParEach) {
+    entt::DefaultRegistry registry;
+    entt::ThreadPool executor{3};
+
+    for(auto i = 0; i < 3 * ENTT_CHUNK_SIZE; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, i);
+
+        if(i % 2) {
+            registry.assign<char>(entity);
+        }
+    }
+
+    auto view = registry.view<int, char>();
+    const auto &cview = static_cast<const decltype(view) &>(view);
+    std::atomic<int> cnt{0};
+
+    view.par_each(executor, [&cnt](auto, int &value, char &) { ++cnt; value = -value; });
+
+    ASSERT_EQ(cnt, 3 * ENTT_CHUNK_SIZE / 2);
+
+    cview.par_each(executor, [&cnt](auto entity, const int &value, const char &) {
+        ASSERT_EQ(value, -int(entity));
+        --cnt;
+    });
+
+    ASSERT_EQ(cnt, 0);
+}
+
+TEST(View, MultipleComponentExclude) {
+    entt::DefaultRegistry registry;
+
+    const auto e0 = registry.create();
+    registry.assign<int>(e0, 0);
+    registry.assign<char>(e0);
+
+    const auto e1 = registry.create();
+    registry.assign<int>(e1, 1);
+    registry.assign<char>(e1);
+    registry.assign<double>(e1);
+
+    const auto e2 = registry.create();
+    registry.assign<int>(e2, 2);
+    registry.assign<char>(e2);
+    registry.assign<float>(e2);
+
+    auto view = registry.view<int, char>(entt::exclude_t<double, float>{});
+    const auto &cview = view;
+
+    ASSERT_FALSE(view.empty());
+    ASSERT_TRUE(view.contains(e0));
+    ASSERT_FALSE(view.contains(e1));
+    ASSERT_FALSE(view.contains(e2));
+    ASSERT_EQ(*view.begin(), e0);
+    ASSERT_EQ(++view.begin(), view.end());
+    ASSERT_EQ(view.get<int>(e0), 0);
+    ASSERT_EQ(std::get<0>(cview.get<int, char>(e0)), 0);
+
+    std::size_t cnt = 0;
+    view.each([&cnt, e0](const auto entity, int &, char &) { ASSERT_EQ(entity, e0); ++cnt; });
+    cview.each([&cnt](auto, const int &, const char &) { ++cnt; });
+
+    ASSERT_EQ(cnt, std::size_t{2});
+
+    registry.remove<double>(e1);
+
+    ASSERT_TRUE(view.contains(e1));
+    ASSERT_FALSE(view.contains(e2));
+
+    std::atomic<int> atomic{0};
+    view.par_each(entt::ThreadPool{2}, [&atomic](auto, int &value, char &) { atomic += value; });
+
+    ASSERT_EQ(atomic, 1);
+}
+
+TEST(View, SingleComponentExclude) {
+    entt::DefaultRegistry registry;
+
+    const auto e0 = registry.create();
+    registry.assign<int>(e0, 0);
+
+    const auto e1 = registry.create();
+    registry.assign<int>(e1, 1);
+    registry.assign<char>(e1);
+
+    auto view = registry.view<int>(entt::exclude_t<char>{});
+
+    ASSERT_TRUE(view.contains(e0));
+    ASSERT_FALSE(view.contains(e1));
+    ASSERT_EQ(*view.begin(), e0);
+    ASSERT_EQ(++view.begin(), view.end());
+
+    std::size_t cnt = 0;
+    view.each([&cnt](auto, int &value) { ASSERT_EQ(value, 0); ++cnt; });
+
+    ASSERT_EQ(cnt, std::size_t{1});
+}
+
 TEST(PersistentView, Prepare) {
     entt::DefaultRegistry registry;
     registry.prepare<int, char>();
@@ -474,6 +688,36 @@ TEST(PersistentView, Each) {
     ASSERT_EQ(cnt, std::size_t{0});
 }
 
+TEST(PersistentView, ParEach) {
+    entt::DefaultRegistry registry;
+    entt::ThreadPool executor{3};
+    registry.prepare<int, char>();
+
+    for(auto i = 0; i < 3 * ENTT_CHUNK_SIZE; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, i);
+
+        if(i % 2) {
+            registry.assign<char>(entity);
+        }
+    }
+
+    auto view = registry.view<int, char>(entt::persistent_t{});
+    const auto &cview = static_cast<const decltype(view) &>(view);
+    std::atomic<int> cnt{0};
+
+    view.par_each(executor, [&cnt](auto, int &value, char &) { ++cnt; value = -value; });
+
+    ASSERT_EQ(cnt, 3 * ENTT_CHUNK_SIZE / 2);
+
+    cview.par_each(executor, [&cnt](auto entity, const int &value, const char &) {
+        ASSERT_EQ(value, -int(entity));
+        --cnt;
+    });
+
+    ASSERT_EQ(cnt, 0);
+}
+
 TEST(PersistentView, Sort) {
     entt::DefaultRegistry registry;
     registry.prepare<int, unsigned int>();
@@ -509,6 +753,286 @@ TEST(PersistentView, Sort) {
     }
 }
 
+TEST(PersistentView, Exclude) {
+    entt::DefaultRegistry registry;
+
+    const auto e0 = registry.create();
+    registry.assign<int>(e0);
+    registry.assign<char>(e0);
+
+    const auto e1 = registry.create();
+    registry.assign<int>(e1);
+    registry.assign<char>(e1);
+    registry.assign<double>(e1);
+
+    auto view = registry.view<int, char>(entt::persistent_t{}, entt::exclude_t<double>{});
+
+    ASSERT_TRUE((registry.contains<int, char>(entt::exclude_t<double>{})));
+    ASSERT_FALSE((registry.contains<int, char>()));
+    ASSERT_EQ(view.size(), decltype(view)::size_type{1});
+    ASSERT_TRUE(view.contains(e0));
+    ASSERT_FALSE(view.contains(e1));
+
+    registry.assign<double>(e0);
+
+    ASSERT_TRUE(view.empty());
+
+    registry.remove<double>(e1);
+
+    ASSERT_EQ(view.size(), decltype(view)::size_type{1});
+    ASSERT_TRUE(view.contains(e1));
+
+    registry.reset<double>();
+
+    ASSERT_EQ(view.size(), decltype(view)::size_type{2});
+
+    const auto e2 = registry.create();
+    registry.assign<double>(e2);
+    registry.assign<char>(e2);
+    registry.assign<int>(e2);
+
+    ASSERT_FALSE(view.contains(e2));
+
+    registry.destroy(e2);
+    registry.remove<char>(e1);
+
+    ASSERT_EQ(view.size(), decltype(view)::size_type{1});
+    ASSERT_EQ(*view.data(), e0);
+
+    registry.discard<int, char>(entt::exclude_t<double>{});
+
+    ASSERT_FALSE((registry.contains<int, char>(entt::exclude_t<double>{})));
+}
+
+TEST(PersistentView, SingleComponentExclude) {
+    entt::DefaultRegistry registry;
+    registry.prepare<int>(entt::exclude_t<char>{});
+    auto view = registry.view<int>(entt::persistent_t{}, entt::exclude_t<char>{});
+
+    const auto e0 = registry.create();
+    registry.assign<int>(e0);
+
+    const auto e1 = registry.create();
+    registry.assign<char>(e1);
+    registry.assign<int>(e1);
+
+    ASSERT_EQ(view.size(), decltype(view)::size_type{1});
+    ASSERT_TRUE(view.contains(e0));
+
+    std::size_t cnt = 0;
+    view.each([&cnt, e0](const auto entity, int &) { ASSERT_EQ(entity, e0); ++cnt; });
+
+    ASSERT_EQ(cnt, std::size_t{1});
+}
+
+TEST(Group, Functionalities) {
+    entt::DefaultRegistry registry;
+    auto group = registry.view<int, char>(entt::group_t{});
+    const auto &cgroup = group;
+
+    ASSERT_TRUE(group.empty());
+    ASSERT_TRUE((registry.contains<int, char>(entt::group_t{})));
+
+    const auto e0 = registry.create();
+    registry.assign<char>(e0, 'a');
+
+    const auto e1 = registry.create();
+    registry.assign<int>(e1, 1);
+
+    ASSERT_TRUE(group.empty());
+    ASSERT_EQ(group.begin(), group.end());
+
+    registry.assign<int>(e0, 0);
+    registry.assign<char>(e1, 'b');
+
+    ASSERT_FALSE(group.empty());
+    ASSERT_EQ(group.size(), 2u);
+    ASSERT_TRUE(group.contains(e0));
+    ASSERT_TRUE(group.contains(e1));
+
+    for(auto pos = 0u; pos < group.size(); ++pos) {
+        ASSERT_EQ(registry.data<int>()[pos], group.data()[pos]);
+        ASSERT_EQ(registry.data<char>()[pos], group.data()[pos]);
+        ASSERT_EQ(group.raw<int>()[pos], group.get<int>(group.data()[pos]));
+        ASSERT_EQ(cgroup.raw<char>()[pos], cgroup.get<char>(group.data()[pos]));
+    }
+
+    ASSERT_EQ(*(group.begin()+1), group.data()[0]);
+    ASSERT_EQ(std::get<0>(group.get<int, char>(e0)), 0);
+    ASSERT_EQ(std::get<1>(cgroup.get<int, char>(e1)), 'b');
+
+    const auto e2 = registry.create();
+    registry.assign<int>(e2, 2);
+
+    ASSERT_EQ(group.size(), 2u);
+    ASSERT_FALSE(group.contains(e2));
+
+    registry.remove<char>(e0);
+
+    ASSERT_EQ(group.size(), 1u);
+    ASSERT_FALSE(group.contains(e0));
+    ASSERT_TRUE(group.contains(e1));
+    ASSERT_EQ(*group.data(), e1);
+    ASSERT_EQ(*group.raw<int>(), 1);
+    ASSERT_EQ(*group.raw<char>(), 'b');
+
+    registry.destroy(e1);
+
+    ASSERT_TRUE(group.empty());
+
+    registry.discard<int, char>(entt::group_t{});
+
+    ASSERT_FALSE((registry.contains<int, char>(entt::group_t{})));
+}
+
+TEST(Group, PrepareWithEntities) {
+    entt::DefaultRegistry registry;
+
+    for(auto i = 0; i < 10; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, i);
+
+        if(i % 2) {
+            registry.assign<char>(entity);
+        }
+    }
+
+    registry.prepare<int, char>(entt::group_t{});
+    auto group = registry.view<int, char>(entt::group_t{});
+
+    ASSERT_EQ(group.size(), 5u);
+
+    for(auto pos = 0u; pos < group.size(); ++pos) {
+        ASSERT_EQ(registry.data<int>()[pos], registry.data<char>()[pos]);
+        ASSERT_EQ(group.raw<int>()[pos] % 2, 1);
+    }
+}
+
+TEST(Group, Each) {
+    entt::DefaultRegistry registry;
+    auto group = registry.view<int, char>(entt::group_t{});
+
+    for(auto i = 0; i < 10; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, i);
+
+        if(i % 2) {
+            registry.assign<char>(entity);
+        }
+    }
+
+    const auto &cgroup = group;
+    std::size_t cnt = 0;
+
+    group.each([&cnt](auto, int &value, char &) { ++cnt; ++value; });
+
+    ASSERT_EQ(cnt, std::size_t{5});
+
+    cgroup.each([&cnt, &registry](auto entity, const int &value, const char &) {
+        ASSERT_EQ(registry.get<int>(entity), value);
+        ASSERT_EQ(value % 2, 0);
+        --cnt;
+    });
+
+    ASSERT_EQ(cnt, std::size_t{0});
+
+    std::atomic<int> atomic{0};
+    group.par_each(entt::ThreadPool{2}, [&atomic](auto, int &, char &) { ++atomic; });
+
+    ASSERT_EQ(atomic, 5);
+}
+
+TEST(View, EmptyComponent) {
+    struct Empty {};
+    entt::DefaultRegistry registry;
+    entt::ThreadPool pool{2};
+
+    const auto e0 = registry.create();
+    registry.assign<Empty>(e0);
+    registry.assign<int>(e0, 0);
+
+    const auto e1 = registry.create();
+    registry.assign<Empty>(e1);
+    registry.assign<int>(e1, 1);
+
+    const auto e2 = registry.create();
+    registry.assign<Empty>(e2);
+
+    registry.prepare<int, Empty>();
+    registry.prepare<char, Empty>(entt::group_t{});
+
+    registry.assign<char>(e1, 'c');
+    registry.assign<char>(e2, 'c');
+
+    std::atomic<std::size_t> counter{};
+    const Empty *instance = registry.raw<Empty>();
+    auto check = [&counter, instance](auto, const Empty &empty, auto...) { ASSERT_EQ(&empty, instance); ++counter; };
+
+    registry.view<Empty>().each(check);
+    registry.view<Empty>().par_each(pool, check);
+
+    ASSERT_EQ(counter, 6u);
+
+    registry.view<int, Empty>().each([&check](auto entity, auto, const auto &empty) { check(entity, empty); });
+    registry.view<int, Empty>(entt::persistent_t{}).each([&check](auto entity, auto, const auto &empty) { check(entity, empty); });
+    registry.view<char, Empty>(entt::group_t{}).each([&check](auto entity, auto, const auto &empty) { check(entity, empty); });
+    registry.view<char, Empty>(entt::group_t{}).par_each(pool, [&check](auto entity, auto, const auto &empty) { check(entity, empty); });
+
+    ASSERT_EQ(counter, 14u);
+
+    registry.view<Empty>(entt::raw_t{}).each([instance, &counter](const Empty &empty) { ASSERT_EQ(&empty, instance); ++counter; });
+    registry.destroy(e1);
+
+    ASSERT_EQ(counter, 17u);
+    ASSERT_EQ(registry.view<Empty>().size(), 2u);
+    ASSERT_EQ(&registry.get<Empty>(e0), &registry.get<Empty>(e2));
+}
+
+TEST(View, StructureOfArrays) {
+    using reference_type = entt::SoaReference<Position, false>;
+    using const_reference_type = entt::SoaReference<Position, true>;
+    entt::DefaultRegistry registry;
+    entt::ThreadPool pool{2};
+
+    for(auto i = 0; i < 3; ++i) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, float(i), float(i));
+        registry.assign<int>(entity, i);
+    }
+
+    registry.prepare<Position, int>();
+    registry.prepare<Position, int>(entt::group_t{});
+
+    registry.view<Position>().each([](auto, reference_type position) { position.get<0>() += 1.f; });
+    registry.view<Position>().par_each(pool, [](auto, reference_type position) { position.get<1>() += 1.f; });
+    registry.view<Position, int>().each([](auto, reference_type position, int &) { position.get<0>() += 1.f; });
+    registry.view<Position, int>(entt::persistent_t{}).each([](auto, reference_type position, int &) { position.get<0>() += 1.f; });
+    registry.view<Position, int>(entt::group_t{}).each([](auto, reference_type position, int &) { position.get<1>() += 1.f; });
+    registry.view<Position, int>(entt::group_t{}).par_each(pool, [](auto, reference_type position, int &) { position.get<1>() += 1.f; });
+    registry.view<Position>(entt::raw_t{}).each([](auto &&position) { position = Position{position.template get<0>(), position.template get<1>() * 2.f}; });
+
+    const auto cview = registry.view<Position, int>();
+
+    cview.each([](auto, const_reference_type position, const int &value) {
+        ASSERT_EQ(position.get<0>(), value + 3.f);
+        ASSERT_EQ(position.get<1>(), (value + 3.f) * 2.f);
+    });
+
+    auto view = registry.view<Position>();
+    const float *x = view.raw().get<0>();
+    const float *y = view.raw().get<1>();
+
+    for(auto pos = 0u; pos < view.size(); ++pos) {
+        ASSERT_EQ(y[pos], 2.f * x[pos]);
+    }
+
+    auto group = registry.view<Position, int>(entt::group_t{});
+
+    for(auto pos = 0u; pos < group.size(); ++pos) {
+        ASSERT_EQ(group.raw<Position>().get<0>()[pos], group.raw<int>()[pos] + 3.f);
+    }
+}
+
 TEST(RawView, Functionalities) {
     entt::DefaultRegistry registry;
     auto view = registry.view<char>(entt::raw_t{});
@@ -623,3 +1147,104 @@ TEST(RawView, Each) {
 
     ASSERT_EQ(cnt, std::size_t{0});
 }
+
+TEST(RawView, EachChunk) {
+    entt::DefaultRegistry registry;
+
+    for(auto i = 0; i < ENTT_CHUNK_SIZE + 1; ++i) {
+        registry.assign<int>(registry.create(), 1);
+    }
+
+    auto view = registry.view<int>(entt::raw_t{});
+    const auto &cview = static_cast<const decltype(view) &>(view);
+    std::size_t cnt = 0;
+
+    view.each_chunk([&cnt, &view](int *values, std::size_t count) {
+        ASSERT_EQ(values, view.raw() + cnt);
+        cnt += count;
+    });
+
+    ASSERT_EQ(cnt, std::size_t{ENTT_CHUNK_SIZE + 1});
+
+    cview.each_chunk([&cnt](const int *values, std::size_t count) {
+        cnt -= std::accumulate(values, values + count, std::size_t{});
+    });
+
+    ASSERT_EQ(cnt, 0u);
+}
+
+TEST(RuntimeView, Functionalities) {
+    entt::DefaultRegistry registry;
+    using component_type = typename entt::DefaultRegistry::component_type;
+    component_type types[] = { registry.type<int>(), registry.type<char>() };
+
+    auto view = registry.runtime_view(std::begin(types), std::end(types));
+
+    ASSERT_TRUE(view.empty());
+    ASSERT_EQ(view.begin(), view.end());
+
+    const auto e0 = registry.create();
+    registry.assign<char>(e0);
+
+    const auto e1 = registry.create();
+    registry.assign<int>(e1);
+    registry.assign<char>(e1);
+
+    // pools didn't exist when the view was created
+    ASSERT_TRUE(view.empty());
+
+    view = registry.runtime_view(std::begin(types), std::end(types));
+
+    ASSERT_FALSE(view.empty());
+    ASSERT_EQ(view.size(), 1u);
+    ASSERT_NE(view.begin(), view.end());
+    ASSERT_EQ(*view.begin(), e1);
+    ASSERT_EQ(++view.begin(), view.end());
+    ASSERT_FALSE(view.contains(e0));
+    ASSERT_TRUE(view.contains(e1));
+
+    registry.remove<char>(e1);
+
+    ASSERT_EQ(view.begin(), view.end());
+    ASSERT_FALSE(view.contains(e1));
+}
+
+TEST(RuntimeView, Each) {
+    entt::DefaultRegistry registry;
+    using component_type = typename entt::DefaultRegistry::component_type;
+
+    const auto e0 = registry.create();
+    registry.assign<int>(e0);
+    registry.assign<char>(e0);
+
+    const auto e1 = registry.create();
+    registry.assign<int>(e1);
+    registry.assign<char>(e1);
+    registry.assign<double>(e1);
+
+    registry.assign<char>(registry.create());
+    registry.assign<int>(registry.create());
+
+    component_type types[] = { registry.type<int>(), registry.type<char>() };
+    auto view = registry.runtime_view(std::begin(types), std::end(types));
+    std::size_t cnt = 0;
+
+    view.each([&cnt](auto) { ++cnt; });
+
+    ASSERT_EQ(cnt, std::size_t{2});
+
+    component_type other[] = { registry.type<char>(), registry.type<double>(), registry.type<int>() };
+
+    registry.runtime_view(std::begin(other), std::end(other)).each([e1](auto entity) {
+        ASSERT_EQ(entity, e1);
+    });
+
+    component_type missing[] = { registry.type<int>(), registry.type<float>() };
+    auto empty = registry.runtime_view(std::begin(missing), std::end(missing));
+
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ(empty.size(), 0u);
+    ASSERT_FALSE(empty.contains(e0));
+
+    empty.each([](auto) { FAIL(); });
+}
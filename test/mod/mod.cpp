@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include <cassert>
+#include <vector>
+#include <algorithm>
 #include <map>
 #include <string>
 #include <duktape.h>
@@ -231,38 +233,49 @@ public:
     static duk_ret_t entities(duk_context *ctx) {
         const duk_idx_t nargs = duk_get_top(ctx);
         auto &dreg = instance(ctx);
+        auto &registry = dreg.registry;
+        std::vector<entt::DefaultRegistry::component_type> types;
+        std::vector<duk_uint_t> runtime;
         duk_uarridx_t pos = 0;
 
+        for(duk_idx_t arg = 0; arg < nargs; arg++) {
+            auto type = duk_require_uint(ctx, arg);
+
+            if(type < udef) {
+                assert(dreg.func.find(type) != dreg.func.cend());
+                types.push_back(type);
+            } else {
+                runtime.push_back(type);
+            }
+        }
+
+        if(!runtime.empty()) {
+            types.push_back(registry.type<DuktapeRuntime>());
+        }
+
         duk_push_array(ctx);
 
-        dreg.registry.each([ctx, nargs, &pos, &dreg](auto entity) {
-            auto &registry = dreg.registry;
-            auto &func = dreg.func;
+        auto visit = [ctx, &pos, &registry, &runtime](auto entity) {
             bool match = true;
 
-            for (duk_idx_t arg = 0; match && arg < nargs; arg++) {
-                auto type = duk_require_uint(ctx, arg);
-
-                if(type < udef) {
-                    assert(func.find(type) != func.cend());
-                    match = (registry.*func[type].test)(entity);
-                } else {
-                    const auto ctype = registry.type<DuktapeRuntime>();
-                    assert(func.find(ctype) != func.cend());
-                    match = (registry.*func[ctype].test)(entity);
-
-                    if(match) {
-                        auto &components = registry.get<DuktapeRuntime>(entity).components;
-                        match = (components.find(type) != components.cend());
-                    }
-                }
+            if(!runtime.empty()) {
+                auto &components = registry.get<DuktapeRuntime>(entity).components;
+                match = std::all_of(runtime.cbegin(), runtime.cend(), [&components](const auto type) {
+                    return components.find(type) != components.cend();
+                });
             }
 
             if(match) {
                 duk_push_uint(ctx, entity);
                 duk_put_prop_index(ctx, -2, pos++);
             }
-        });
+        };
+
+        if(types.empty()) {
+            registry.each(visit);
+        } else {
+            registry.runtime_view(types.cbegin(), types.cend()).each(visit);
+        }
 
         return 1;
     }